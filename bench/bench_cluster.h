@@ -0,0 +1,184 @@
+#ifndef MYRAFT_BENCH_BENCH_CLUSTER_H_
+#define MYRAFT_BENCH_BENCH_CLUSTER_H_
+
+#include <stdint.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <functional>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include <raft/multi_raft.h>
+#include <transport/loopback_transport.h>
+#include <util/util.h>
+
+#include "mem_storage.h"
+
+namespace myraft {
+
+// BenchCluster runs one raft group on N MultiRaft hosts connected by a
+// LoopbackNetwork, so that a benchmark can drive the whole replication path
+// in one process. Storage is in memory and committed entries are handed to
+// the apply callback, read states to the read callback, both on the hosts'
+// worker threads.
+//
+// Coalesced heartbeats are stepped on the destination host directly, they
+// do not go through the simulated links.
+class BenchCluster {
+ public:
+  static const uint64_t kGroup = 1;
+
+  using ApplyCallback = std::function<void(uint64_t node, const raftpb::Entry& entry)>;
+  using ReadCallback  = std::function<void(uint64_t node, const ReadState& read_state)>;
+
+ public:
+  // config is the template of every node's config, id, peers and storage are
+  // filled in.
+  BenchCluster(size_t nodes, const LoopbackNetwork::LinkOptions& link, const Config& config)
+      : network_(1), refused_(0) {
+    network_.SetDefaultLink(link);
+
+    std::vector<uint64_t> peers;
+    for (uint64_t id = 1; id <= nodes; id++) {
+      peers.push_back(id);
+    }
+    for (uint64_t id = 1; id <= nodes; id++) {
+      std::unique_ptr<Node> node(new Node(this, id));
+      node->transport = network_.AddNode(id, node.get());
+
+      Config node_config = config;
+      node_config.id      = id;
+      node_config.peers   = peers;
+      node_config.storage = node->storage;
+      node->host->AddGroup(kGroup, node_config);
+      nodes_[id] = std::move(node);
+    }
+  }
+
+  ~BenchCluster() {
+    Stop();
+  }
+
+  BenchCluster(const BenchCluster&)            = delete;
+  BenchCluster& operator=(const BenchCluster&) = delete;
+  BenchCluster(BenchCluster&&)                 = delete;
+  BenchCluster& operator=(BenchCluster&&)      = delete;
+
+  // before Start.
+  void SetCallbacks(ApplyCallback on_apply, ReadCallback on_read) {
+    on_apply_ = std::move(on_apply);
+    on_read_  = std::move(on_read);
+  }
+
+  bool Start() {
+    if (!network_.Start()) {
+      return false;
+    }
+    for (auto& node : nodes_) {
+      node.second->host->Start();
+    }
+    return true;
+  }
+
+  void Stop() {
+    for (auto& node : nodes_) {
+      node.second->host->Stop();
+    }
+    network_.Stop();
+  }
+
+  void Tick() {
+    for (auto& node : nodes_) {
+      node.second->host->Tick();
+    }
+  }
+
+  // ticks every interval microseconds until a leader is known, returns it,
+  // 0 on timeout.
+  uint64_t WaitLeader(uint64_t interval, uint64_t timeout) {
+    uint64_t deadline = myutil::MonotonicMicros() + timeout;
+    while (myutil::MonotonicMicros() < deadline) {
+      for (auto& node : nodes_) {
+        uint64_t lead = node.second->lead.load();
+        if (node.first == lead) {
+          return lead;
+        }
+      }
+      Tick();
+      usleep(static_cast<useconds_t>(interval));
+    }
+    return 0;
+  }
+
+  MultiRaft* Host(uint64_t id) { return nodes_[id]->host.get(); }
+  // proposals refused by the node they were made on.
+  uint64_t Refused() const { return refused_.load(); }
+  LoopbackNetwork* Network() { return &network_; }
+
+ private:
+  struct Node : public MultiRaft::Handler, public Transport::Handler {
+    Node(BenchCluster* bench_cluster, uint64_t node_id)
+        : cluster(bench_cluster), id(node_id), lead(kNone),
+          host(new MultiRaft(node_id, 1, this)), transport(nullptr),
+          storage(new MemStorage) {}
+
+    virtual void HandleReady(uint64_t group_id, RawNode*, Ready* rd) override {
+      if (nullptr != rd->soft_state) {
+        lead = rd->soft_state->lead;
+      }
+
+      transport->Send(group_id, &rd->messages);
+      storage->Append(rd->entries);
+      if (0 != rd->hard_state.term() || 0 != rd->hard_state.commit()) {
+        storage->SetHardState(rd->hard_state);
+      }
+      transport->Send(group_id, &rd->messages_after_append);
+
+      if (cluster->on_apply_) {
+        for (const auto& entry : rd->committed_entries) {
+          cluster->on_apply_(id, entry);
+        }
+      }
+      if (cluster->on_read_) {
+        for (const auto& read_state : rd->read_states) {
+          cluster->on_read_(id, read_state);
+        }
+      }
+    }
+
+    virtual void SendHeartbeats(raftpb::HeartbeatBatch* batch) override {
+      cluster->Host(batch->to())->StepHeartbeats(*batch);
+    }
+
+    virtual void ReportProposal(uint64_t, std::string, Raft::Error) override {
+      cluster->refused_++;
+    }
+
+    virtual void HandleMessages(uint64_t group_id, Transport::Messages* msgs) override {
+      host->Step(group_id, msgs);
+    }
+
+    virtual void ReportUnreachable(uint64_t) override {}
+    virtual void ReportSnapshot(uint64_t, uint64_t, bool) override {}
+
+    BenchCluster*               cluster;
+    const uint64_t              id;
+    std::atomic<uint64_t>       lead;
+    std::unique_ptr<MultiRaft>  host;
+    Transport*                  transport;
+    std::shared_ptr<MemStorage> storage;
+  }; // struct Node
+
+ private:
+  LoopbackNetwork                           network_;
+  std::map<uint64_t, std::unique_ptr<Node>> nodes_;
+  ApplyCallback                             on_apply_;
+  ReadCallback                              on_read_;
+  std::atomic<uint64_t>                     refused_;
+}; // class BenchCluster
+
+} // namespace myraft
+
+#endif // MYRAFT_BENCH_BENCH_CLUSTER_H_
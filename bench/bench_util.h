@@ -0,0 +1,37 @@
+#ifndef MYRAFT_BENCH_BENCH_UTIL_H_
+#define MYRAFT_BENCH_BENCH_UTIL_H_
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace myraft {
+
+// prints the count, mean and percentiles of latencies in microseconds,
+// which are sorted in place.
+inline void PrintLatencies(const char* name, std::vector<uint64_t>* latencies) {
+  if (latencies->empty()) {
+    printf("%-24s no samples\n", name);
+    return ;
+  }
+
+  std::sort(latencies->begin(), latencies->end());
+  uint64_t sum = 0;
+  for (uint64_t latency : *latencies) {
+    sum += latency;
+  }
+
+  auto at = [latencies](double q) {
+    size_t i = static_cast<size_t>(q * (latencies->size() - 1));
+    return static_cast<unsigned long long>((*latencies)[i]);
+  };
+  printf("%-24s n=%zu mean=%llu p50=%llu p90=%llu p99=%llu max=%llu us\n",
+         name, latencies->size(), static_cast<unsigned long long>(sum / latencies->size()),
+         at(0.5), at(0.9), at(0.99), at(1));
+}
+
+} // namespace myraft
+
+#endif // MYRAFT_BENCH_BENCH_UTIL_H_
@@ -0,0 +1,65 @@
+// g++ -std=c++11 -O2 -I. -Iutil bench/channel_bench.cc util/*.cc -lpthread -o channel_bench
+//
+// Messages per second through the pipe backed Channel and the eventfd backed
+// EventChannel, with writers pushing ints as fast as they can and one reader
+// polling the channel's fd and draining it.
+
+#include <poll.h>
+#include <stdio.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <transport/channel.h.h>
+#include <transport/event_channel.h>
+#include <util/util.h>
+
+static const int kMessages = 4000000;
+
+template <typename ChannelType>
+static void Run(const char* name, ChannelType* channel, int writers) {
+  std::vector<std::thread> threads;
+  int per_writer = kMessages / writers;
+  uint64_t start = myutil::MonotonicMicros();
+  for (int w = 0; w < writers; w++) {
+    threads.emplace_back([channel, per_writer] {
+      for (int i = 0; i < per_writer; i++) {
+        channel->Write(i);
+      }
+    });
+  }
+
+  int got = 0;
+  uint64_t wakeups = 0;
+  while (got < per_writer * writers) {
+    struct pollfd pfd;
+    pfd.fd     = channel->ReadFD();
+    pfd.events = POLLIN;
+    poll(&pfd, 1, -1);
+    wakeups++;
+
+    auto queue = channel->Read();
+    while (!queue->Empty()) {
+      queue->Pop();
+      got++;
+    }
+  }
+  uint64_t us = myutil::MonotonicMicros() - start;
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  printf("%-14s writers=%d %8.0f kmsg/s, %lu wakeups\n", name, writers,
+         got * 1000.0 / us, static_cast<unsigned long>(wakeups));
+}
+
+int main() {
+  for (int writers : {1, 4}) {
+    auto pipe_channel = myutil::MakeChannel<int>();
+    Run("Channel", pipe_channel.get(), writers);
+    auto event_channel = myutil::MakeEventChannel<int>();
+    Run("EventChannel", event_channel.get(), writers);
+  }
+  return 0;
+}
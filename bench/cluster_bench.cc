@@ -0,0 +1,123 @@
+// g++ -std=c++11 -O2 -I. -Iutil -Iraft bench/cluster_bench.cc raft/*.cc raft/raftpb/*.pb.cc transport/*.cc util/*.cc -lprotobuf -lpthread -lz -o cluster_bench
+//
+// Commit throughput and latency of a whole cluster on a LoopbackNetwork. The
+// leader is kept busy with a window of proposals in flight, a proposal's
+// latency runs from Propose to its entry being applied on the leader.
+
+#include <stdio.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <util/coding.h>
+
+#include "bench_cluster.h"
+#include "bench_util.h"
+
+using namespace myraft;
+
+static const uint64_t kTickInterval = 10000;
+
+static void Run(size_t nodes, const LoopbackNetwork::LinkOptions& link, size_t size, int window,
+                int proposals) {
+  Config config{};
+  config.election_tick            = 10;
+  config.heartbeat_tick           = 1;
+  config.tick_interval            = kTickInterval;
+  config.max_size_per_msg         = 1 << 20;
+  config.max_inflight_msgs        = 256;
+  config.max_proposal_batch_bytes = 64 << 10;
+  config.proposal_batch_window    = 1000;
+  config.check_quorum             = true;
+  config.pre_vote                 = true;
+
+  std::mutex mutex;
+  std::unordered_map<uint64_t, uint64_t> started;
+  std::vector<uint64_t> latencies;
+  std::atomic<uint64_t> leader(0);
+  std::atomic<int> in_flight(0);
+
+  BenchCluster cluster(nodes, link, config);
+  cluster.SetCallbacks([&](uint64_t node, const raftpb::Entry& entry) {
+    if (node != leader.load() || entry.data().size() < sizeof(uint64_t)) {
+      return ;
+    }
+    uint64_t id = myutil::DecodeFixed64(entry.data().data());
+    uint64_t now = myutil::MonotonicMicros();
+    std::lock_guard<std::mutex> guard(mutex);
+    auto iter = started.find(id);
+    if (started.end() != iter) {
+      latencies.push_back(now - iter->second);
+      started.erase(iter);
+      in_flight--;
+    }
+  }, nullptr);
+  if (!cluster.Start()) {
+    printf("failed to start the cluster\n");
+    return ;
+  }
+
+  leader = cluster.WaitLeader(kTickInterval, 5000000);
+  if (0 == leader.load()) {
+    printf("no leader\n");
+    return ;
+  }
+  std::atomic<bool> stop(false);
+  std::thread ticker([&cluster, &stop] {
+    while (!stop.load()) {
+      cluster.Tick();
+      usleep(kTickInterval);
+    }
+  });
+
+  MultiRaft* host = cluster.Host(leader.load());
+  std::string data(size < sizeof(uint64_t) ? sizeof(uint64_t) : size, 'x');
+  uint64_t start = myutil::MonotonicMicros();
+  uint64_t deadline = start + 60000000;
+  for (uint64_t id = 0; id < static_cast<uint64_t>(proposals); id++) {
+    while (in_flight.load() >= window && myutil::MonotonicMicros() < deadline) {
+      usleep(10);
+    }
+    myutil::EncodeFixed64(&data[0], id);
+    {
+      std::lock_guard<std::mutex> guard(mutex);
+      started[id] = myutil::MonotonicMicros();
+    }
+    in_flight++;
+    host->Propose(BenchCluster::kGroup, data);
+  }
+  while (in_flight.load() > 0 && myutil::MonotonicMicros() < deadline) {
+    usleep(100);
+  }
+  uint64_t us = myutil::MonotonicMicros() - start;
+
+  stop = true;
+  ticker.join();
+  cluster.Stop();
+
+  LoopbackNetwork::Stats stats = cluster.Network()->GetStats();
+  std::lock_guard<std::mutex> guard(mutex);
+  printf("nodes=%zu latency=%lluus size=%zu window=%d: %zu commits in %llu us, %.0f commits/s, "
+         "%lu messages\n",
+         nodes, static_cast<unsigned long long>(link.latency), size, window, latencies.size(),
+         static_cast<unsigned long long>(us), latencies.size() * 1e6 / us,
+         static_cast<unsigned long>(stats.delivered));
+  PrintLatencies("  commit latency", &latencies);
+}
+
+int main() {
+  LoopbackNetwork::LinkOptions lan{100, 1000 << 20, 0};
+  LoopbackNetwork::LinkOptions wan{5000, 100 << 20, 0};
+  for (size_t nodes : {3, 5}) {
+    Run(nodes, lan, 128, 1, 5000);
+    Run(nodes, lan, 128, 256, 50000);
+    Run(nodes, wan, 128, 256, 50000);
+    Run(nodes, wan, 4096, 256, 50000);
+  }
+  return 0;
+}
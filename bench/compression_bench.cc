@@ -0,0 +1,169 @@
+// g++ -std=c++11 -O2 -I. -Iutil -Iraft bench/compression_bench.cc transport/*.cc raft/message_encoder.cc raft/raftpb/*.pb.cc util/*.cc -lprotobuf -lpthread -lz -o compression_bench
+//
+// What compressed MsgApp buys on a link of limited bandwidth. Loopback tcp
+// has no bandwidth limit to speak of, so the codec is measured on its own:
+// the ratio and the deflate and inflate rates of MessageEncoder give the
+// entry bytes per second a link of a given bandwidth carries, which is
+// bounded by the link for raw entries and by the link over the ratio or the
+// codec for compressed ones. A TcpTransport run over loopback with and
+// without compression shows what the codec costs where bandwidth is free.
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <string>
+
+#include <raft/message_encoder.h>
+#include <transport/tcp_transport.h>
+#include <util/util.h>
+
+using namespace myraft;
+
+static const int kEntriesPerMsg = 4;
+
+// log records of a typical state machine, compress well.
+static std::string JsonEntry(int i) {
+  std::string data;
+  char buf[128];
+  for (int k = 0; k < 20; k++) {
+    snprintf(buf, sizeof(buf), "{\"id\":%d,\"user\":\"user-%d\",\"op\":\"put\",\"value\":\"v%d\"},",
+             i * 20 + k, (i + k) % 97, k);
+    data += buf;
+  }
+  return data;
+}
+
+// already compressed or encrypted payloads, do not.
+static std::string RandomEntry(int) {
+  std::string data(1500, '\0');
+  for (auto& c : data) {
+    c = static_cast<char>(rand());
+  }
+  return data;
+}
+
+static void MakeMsgApp(raftpb::Message* m, uint64_t to, uint64_t index,
+                       const std::function<std::string(int)>& entry) {
+  m->set_type(raftpb::MsgApp);
+  m->set_to(to);
+  m->set_index(index);
+  for (int j = 0; j < kEntriesPerMsg; j++) {
+    raftpb::Entry* e = m->add_entries();
+    e->set_index(index + j + 1);
+    e->set_term(1);
+    e->set_data(entry(static_cast<int>(index) + j));
+  }
+}
+
+static void Codec(const char* name, const std::function<std::string(int)>& entry, int count) {
+  std::vector<raftpb::Message> msgs(count);
+  for (int i = 0; i < count; i++) {
+    MakeMsgApp(&msgs[i], 2, static_cast<uint64_t>(i) * kEntriesPerMsg, entry);
+  }
+
+  // a fresh encoder per message, or the cache would hand back the work.
+  uint64_t raw = 0, wire = 0;
+  std::vector<EncodedMessage> encoded(count);
+  uint64_t start = myutil::MonotonicMicros();
+  for (int i = 0; i < count; i++) {
+    MessageEncoder encoder;
+    encoder.Encode(1, &msgs[i], &encoded[i], true);
+    raw  += encoded[i].compressed ? encoded[i].raw_entries_size : encoded[i].entries->size();
+    wire += encoded[i].entries->size();
+  }
+  uint64_t deflate_us = myutil::MonotonicMicros() - start;
+
+  start = myutil::MonotonicMicros();
+  std::string out;
+  for (int i = 0; i < count; i++) {
+    if (encoded[i].compressed) {
+      out.clear();
+      const std::string& entries = *encoded[i].entries;
+      InflateEntries(entries.data(), entries.size(), encoded[i].raw_entries_size, &out);
+    }
+  }
+  uint64_t inflate_us = myutil::MonotonicMicros() - start;
+
+  // entries that do not shrink are sent raw and never inflated, but the
+  // deflate was tried all the same.
+  double ratio   = static_cast<double>(raw) / wire;
+  double deflate = static_cast<double>(raw) / std::max<uint64_t>(deflate_us, 1);
+  double codec   = deflate;
+  if (wire < raw) {
+    codec = std::min(codec, static_cast<double>(raw) / std::max<uint64_t>(inflate_us, 1));
+  }
+  printf("%-6s ratio %.2f, codec %.0f MB/s\n", name, ratio, codec);
+  for (double link : {10.0, 100.0, 1000.0}) {
+    double compressed = std::min(codec, link * ratio);
+    printf("  link %5.0f MB/s: raw %6.0f MB/s, compressed %6.0f MB/s of entries\n",
+           link, link, compressed);
+  }
+}
+
+class BenchHandler : public Transport::Handler {
+ public:
+  BenchHandler() : got(0) {}
+
+  virtual void HandleMessages(uint64_t, Transport::Messages* msgs) override {
+    got += static_cast<int>(msgs->size());
+  }
+  virtual void ReportUnreachable(uint64_t) override {}
+  virtual void ReportSnapshot(uint64_t, uint64_t, bool) override {}
+
+  int got;
+}; // class BenchHandler
+
+static void Loopback(bool compress, int count) {
+  auto loop = myutil::MakeEventLoop();
+  BenchHandler h1, h2;
+  TcpTransport a(1, loop.get(), &h1);
+  TcpTransport b(2, loop.get(), &h2);
+  if (compress) {
+    a.EnableCompression();
+    b.EnableCompression();
+  }
+  if (!a.Start() || !b.Start() || !a.Listen("127.0.0.1", 0) || !b.Listen("127.0.0.1", 0)) {
+    printf("failed to start\n");
+    return ;
+  }
+  a.AddPeer(2, "127.0.0.1", b.Port());
+  b.AddPeer(1, "127.0.0.1", a.Port());
+
+  // compression starts once a has b's hello.
+  std::unique_ptr<raftpb::Message> hello(new raftpb::Message);
+  hello->set_type(raftpb::MsgHeartbeat);
+  hello->set_to(1);
+  b.Send(std::move(hello));
+  while (h1.got < 1) {
+    loop->RunOnce(10);
+  }
+
+  size_t bytes = 0;
+  uint64_t start = myutil::MonotonicMicros();
+  for (int i = 0; i < count; i++) {
+    std::unique_ptr<raftpb::Message> m(new raftpb::Message);
+    MakeMsgApp(m.get(), 2, static_cast<uint64_t>(i) * kEntriesPerMsg, JsonEntry);
+    for (const auto& e : m->entries()) {
+      bytes += e.data().size();
+    }
+    a.Send(std::move(m));
+  }
+  while (h2.got < count && myutil::MonotonicMicros() - start < 60000000) {
+    loop->RunOnce(10);
+  }
+  uint64_t us = myutil::MonotonicMicros() - start;
+
+  printf("loopback tcp compression=%d: %8.0f msg/s %6.1f MB/s of entries\n", compress,
+         h2.got * 1e6 / us, static_cast<double>(bytes) / us);
+}
+
+int main() {
+  Codec("json", JsonEntry, 20000);
+  Codec("random", RandomEntry, 20000);
+  Loopback(false, 20000);
+  Loopback(true, 20000);
+  return 0;
+}
@@ -0,0 +1,103 @@
+#ifndef MYRAFT_BENCH_MEM_STORAGE_H_
+#define MYRAFT_BENCH_MEM_STORAGE_H_
+
+#include <stdint.h>
+
+#include <mutex>
+#include <vector>
+
+#include <raft/storage.h>
+
+namespace myraft {
+
+// MemStorage keeps the log in memory, for benchmarks only. There is no
+// snapshot or compaction, the entry at ents_[0] is the dummy at index 0.
+class MemStorage : public Storage {
+ private:
+  using Entries = ::google::protobuf::RepeatedPtrField<::raftpb::Entry>;
+
+ public:
+  MemStorage() : ents_(1) {}
+  virtual ~MemStorage() = default;
+
+  MemStorage(const MemStorage&)            = delete;
+  MemStorage& operator=(const MemStorage&) = delete;
+  MemStorage(MemStorage&&)                 = delete;
+  MemStorage& operator=(MemStorage&&)      = delete;
+
+  virtual Error InitialState(raftpb::HardState* hard_state,
+                             raftpb::ConfState* conf_state) const override {
+    std::lock_guard<std::mutex> guard(mutex_);
+    *hard_state = hard_state_;
+    conf_state->Clear();
+    return OK;
+  }
+
+  virtual Error GetEntries(uint64_t low, uint64_t high, uint64_t max_size,
+                           Entries* entries) const override {
+    std::lock_guard<std::mutex> guard(mutex_);
+    if (0 == low) {
+      return ErrCompacted;
+    }
+    if (high > ents_.size()) {
+      return ErrUnavailable;
+    }
+    uint64_t size = 0;
+    for (uint64_t i = low; i < high; i++) {
+      size += ents_[i].ByteSizeLong();
+      if (size > max_size && i > low) {
+        break;
+      }
+      *entries->Add() = ents_[i];
+    }
+    return OK;
+  }
+
+  virtual Error Term(uint64_t index, uint64_t* result) const override {
+    std::lock_guard<std::mutex> guard(mutex_);
+    if (index >= ents_.size()) {
+      return ErrUnavailable;
+    }
+    *result = ents_[index].term();
+    return OK;
+  }
+
+  virtual Error LastIndex(uint64_t* result) const override {
+    std::lock_guard<std::mutex> guard(mutex_);
+    *result = ents_.size() - 1;
+    return OK;
+  }
+
+  virtual Error FirstIndex(uint64_t* result) const override {
+    *result = 1;
+    return OK;
+  }
+
+  virtual Error Snapshot(raftpb::Snapshot* snapshot) const override {
+    snapshot->Clear();
+    return ErrSnapshotTemporarilyUnavailable;
+  }
+
+  // entries overwrite whatever the log holds from their first index on.
+  void Append(const Entries& entries) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    for (const auto& entry : entries) {
+      ents_.resize(entry.index());
+      ents_.push_back(entry);
+    }
+  }
+
+  void SetHardState(const raftpb::HardState& hard_state) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    hard_state_ = hard_state;
+  }
+
+ private:
+  mutable std::mutex          mutex_;
+  raftpb::HardState           hard_state_;
+  std::vector<raftpb::Entry>  ents_;
+}; // class MemStorage
+
+} // namespace myraft
+
+#endif // MYRAFT_BENCH_MEM_STORAGE_H_
@@ -0,0 +1,90 @@
+// g++ -std=c++11 -O2 -I. -Iutil -Iraft bench/read_index_bench.cc raft/*.cc raft/raftpb/*.pb.cc transport/*.cc util/*.cc -lprotobuf -lpthread -lz -o read_index_bench
+//
+// Latency of linearizable reads at the leader of a 3 node cluster whose links
+// take 500us each way, ReadOnlySafe against ReadOnlyLeaseBased. Reads are
+// issued one at a time and done when their ReadState comes back.
+
+#include <stdio.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "bench_cluster.h"
+#include "bench_util.h"
+
+using namespace myraft;
+
+static const uint64_t kTickInterval = 1000;
+static const int      kReads        = 2000;
+
+static void Run(ReadOnly::ReadOnlyOption option, const char* name) {
+  Config config{};
+  config.election_tick       = 10;
+  config.heartbeat_tick      = 1;
+  config.tick_interval       = kTickInterval;
+  config.max_clock_drift     = 100;
+  config.max_size_per_msg    = 1 << 20;
+  config.max_inflight_msgs   = 256;
+  config.check_quorum        = true;
+  config.pre_vote            = true;
+  config.read_only_option    = option;
+
+  std::atomic<uint64_t> applied(0);
+  std::atomic<int>      read(-1);
+  BenchCluster cluster(3, LoopbackNetwork::LinkOptions{500, 0, 0}, config);
+  cluster.SetCallbacks(
+      [&applied](uint64_t, const raftpb::Entry& entry) { applied = entry.index(); },
+      [&read](uint64_t, const ReadState& read_state) { read = std::stoi(read_state.request_ctx); });
+  if (!cluster.Start()) {
+    printf("failed to start the cluster\n");
+    return ;
+  }
+
+  uint64_t leader = cluster.WaitLeader(kTickInterval, 5000000);
+  if (0 == leader) {
+    printf("%s: no leader\n", name);
+    return ;
+  }
+  std::atomic<bool> stop(false);
+  std::thread ticker([&cluster, &stop] {
+    while (!stop.load()) {
+      cluster.Tick();
+      usleep(kTickInterval);
+    }
+  });
+
+  // reads are refused until the leader committed an entry of its term.
+  MultiRaft* host = cluster.Host(leader);
+  host->Propose(BenchCluster::kGroup, "warmup");
+  while (0 == applied.load()) {
+    usleep(100);
+  }
+
+  std::vector<uint64_t> latencies;
+  for (int i = 0; i < kReads; i++) {
+    uint64_t start = myutil::MonotonicMicros();
+    host->ReadIndex(BenchCluster::kGroup, std::to_string(i));
+    while (i != read.load()) {
+      if (myutil::MonotonicMicros() - start > 1000000) {
+        // a read lost to a leader change is issued again.
+        start = myutil::MonotonicMicros();
+        host->ReadIndex(BenchCluster::kGroup, std::to_string(i));
+      }
+    }
+    latencies.push_back(myutil::MonotonicMicros() - start);
+  }
+
+  stop = true;
+  ticker.join();
+  cluster.Stop();
+  PrintLatencies(name, &latencies);
+}
+
+int main() {
+  Run(ReadOnly::ReadOnlySafe, "ReadOnlySafe");
+  Run(ReadOnly::ReadOnlyLeaseBased, "ReadOnlyLeaseBased");
+  return 0;
+}
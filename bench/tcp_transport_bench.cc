@@ -0,0 +1,138 @@
+// g++ -std=c++11 -O2 -I. -Iutil -Iraft bench/tcp_transport_bench.cc transport/*.cc raft/message_encoder.cc raft/raftpb/*.pb.cc util/*.cc -lprotobuf -lpthread -lz -o tcp_transport_bench
+//
+// TcpTransport over loopback at several entry sizes: throughput of a stream
+// of MsgApps from one node to another, and the round trip latency of a
+// MsgApp answered by a MsgAppResp with one message in flight. Both nodes
+// share one event loop on the main thread.
+
+#include <stdio.h>
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <transport/tcp_transport.h>
+#include <util/util.h>
+
+#include "bench_util.h"
+
+using namespace myraft;
+
+class BenchHandler : public Transport::Handler {
+ public:
+  using Callback = std::function<void(raftpb::Message* m)>;
+
+  explicit BenchHandler(Callback callback) : callback_(std::move(callback)) {}
+
+  virtual void HandleMessages(uint64_t, Transport::Messages* msgs) override {
+    for (auto& m : *msgs) {
+      callback_(m.get());
+    }
+  }
+  virtual void ReportUnreachable(uint64_t id) override {
+    printf("node %lu unreachable\n", static_cast<unsigned long>(id));
+  }
+  virtual void ReportSnapshot(uint64_t, uint64_t, bool) override {}
+
+ private:
+  Callback callback_;
+}; // class BenchHandler
+
+static std::unique_ptr<raftpb::Message> MsgApp(uint64_t to, uint64_t index, size_t size) {
+  std::unique_ptr<raftpb::Message> m(new raftpb::Message);
+  m->set_type(raftpb::MsgApp);
+  m->set_to(to);
+  m->set_index(index);
+  raftpb::Entry* entry = m->add_entries();
+  entry->set_index(index + 1);
+  entry->set_term(1);
+  entry->set_data(std::string(size, 'x'));
+  return m;
+}
+
+static void Throughput(size_t size, int count) {
+  auto loop = myutil::MakeEventLoop();
+  int got = 0;
+  BenchHandler h1([](raftpb::Message*) {});
+  BenchHandler h2([&got](raftpb::Message*) { got++; });
+  TcpTransport a(1, loop.get(), &h1);
+  TcpTransport b(2, loop.get(), &h2);
+  if (!a.Start() || !b.Start() || !b.Listen("127.0.0.1", 0)) {
+    printf("failed to start\n");
+    return ;
+  }
+  a.AddPeer(2, "127.0.0.1", b.Port());
+
+  uint64_t start = myutil::MonotonicMicros();
+  std::thread writer([&a, size, count] {
+    for (int i = 0; i < count; i++) {
+      a.Send(MsgApp(2, i, size));
+    }
+  });
+  while (got < count && myutil::MonotonicMicros() - start < 60000000) {
+    loop->RunOnce(10);
+  }
+  uint64_t us = myutil::MonotonicMicros() - start;
+  writer.join();
+
+  printf("throughput size=%-6zu %8.0f msg/s %8.1f MB/s\n", size, got * 1e6 / us,
+         static_cast<double>(got) * size / us);
+}
+
+static void Latency(size_t size, int count) {
+  auto loop = myutil::MakeEventLoop();
+  std::unique_ptr<TcpTransport> a, b;
+  std::vector<uint64_t> latencies;
+  uint64_t sent_at = 0;
+
+  BenchHandler h1([&](raftpb::Message* m) {
+    latencies.push_back(myutil::MonotonicMicros() - sent_at);
+    if (static_cast<int>(latencies.size()) < count) {
+      sent_at = myutil::MonotonicMicros();
+      a->Send(MsgApp(2, m->index() + 1, size));
+    }
+  });
+  BenchHandler h2([&](raftpb::Message* m) {
+    std::unique_ptr<raftpb::Message> resp(new raftpb::Message);
+    resp->set_type(raftpb::MsgAppResp);
+    resp->set_to(1);
+    resp->set_index(m->index());
+    b->Send(std::move(resp));
+  });
+  a.reset(new TcpTransport(1, loop.get(), &h1));
+  b.reset(new TcpTransport(2, loop.get(), &h2));
+  if (!a->Start() || !b->Start() || !a->Listen("127.0.0.1", 0) || !b->Listen("127.0.0.1", 0)) {
+    printf("failed to start\n");
+    return ;
+  }
+  a->AddPeer(2, "127.0.0.1", b->Port());
+  b->AddPeer(1, "127.0.0.1", a->Port());
+
+  uint64_t start = myutil::MonotonicMicros();
+  sent_at = start;
+  a->Send(MsgApp(2, 0, size));
+  while (static_cast<int>(latencies.size()) < count &&
+         myutil::MonotonicMicros() - start < 60000000) {
+    loop->RunOnce(10);
+  }
+
+  // the first round trip pays for the connections.
+  if (!latencies.empty()) {
+    latencies.erase(latencies.begin());
+  }
+  char name[64];
+  snprintf(name, sizeof(name), "round trip size=%zu", size);
+  PrintLatencies(name, &latencies);
+}
+
+int main() {
+  Throughput(16, 200000);
+  Throughput(1024, 200000);
+  Throughput(64 << 10, 2000);
+  Latency(16, 10000);
+  Latency(1024, 10000);
+  Latency(64 << 10, 2000);
+  return 0;
+}
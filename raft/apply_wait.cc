@@ -0,0 +1,45 @@
+#include "apply_wait.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace myraft {
+
+void ApplyWait::Wait(uint64_t index, Callback callback) {
+  if (index <= applied_) {
+    callback();
+    return ;
+  }
+
+  heap_.push_back(Waiter{index, next_seq_++, std::move(callback)});
+  std::push_heap(heap_.begin(), heap_.end(), std::greater<Waiter>());
+}
+
+size_t ApplyWait::Trigger(uint64_t applied) {
+  if (applied <= applied_) {
+    return 0;
+  }
+  applied_ = applied;
+
+  while (!heap_.empty() && heap_.front().index <= applied) {
+    std::pop_heap(heap_.begin(), heap_.end(), std::greater<Waiter>());
+    ready_.push_back(std::move(heap_.back().callback));
+    heap_.pop_back();
+  }
+
+  // callbacks run after the heap is settled, so they may Wait again.
+  std::vector<Callback> ready;
+  ready.swap(ready_);
+  for (auto& callback : ready) {
+    callback();
+  }
+  size_t count = ready.size();
+
+  ready.clear();
+  if (ready_.empty()) {
+    ready_.swap(ready);
+  }
+  return count;
+}
+
+} // namespace myraft
@@ -0,0 +1,57 @@
+#ifndef MYRAFT_APPLY_WAIT_H_
+#define MYRAFT_APPLY_WAIT_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include <functional>
+#include <vector>
+
+namespace myraft {
+
+// ApplyWait parks readers until the applied index reaches the read index
+// they obtained, e.g. a follower serving a read after MsgReadIndexResp.
+// Waiters are kept in a min-heap on index, so Trigger costs O(k log n) for
+// the k waiters it wakes and nothing for the ones still waiting.
+class ApplyWait {
+ public:
+  using Callback = std::function<void()>;
+
+ public:
+  ApplyWait(uint64_t applied) : applied_(applied), next_seq_(0) {}
+  ~ApplyWait() = default;
+
+  ApplyWait(const ApplyWait&)            = delete;
+  ApplyWait& operator=(const ApplyWait&) = delete;
+  ApplyWait(ApplyWait&&)                 = default;
+  ApplyWait& operator=(ApplyWait&&)      = default;
+
+  // callback runs right away if index has already been applied.
+  void Wait(uint64_t index, Callback callback);
+  // wakes every waiter whose index is not greater than applied, waiters of
+  // the same index wake in the order they were registered.
+  size_t Trigger(uint64_t applied);
+
+  size_t Size() const { return heap_.size(); }
+
+ private:
+  struct Waiter {
+    uint64_t index;
+    uint64_t seq;
+    Callback callback;
+
+    bool operator>(const Waiter& other) const {
+      return index > other.index || (index == other.index && seq > other.seq);
+    }
+  }; // struct Waiter
+
+ private:
+  std::vector<Waiter>   heap_;
+  std::vector<Callback> ready_;
+  uint64_t              applied_;
+  uint64_t              next_seq_;
+}; // class ApplyWait
+
+} // namespace myraft
+
+#endif // MYRAFT_APPLY_WAIT_H_
@@ -0,0 +1,105 @@
+#include "heartbeat_coalescer.h"
+
+#include <algorithm>
+
+namespace myraft {
+
+void HeartbeatCoalescer::Extract(uint64_t group_id, Raft::Messages* msgs, bool with_context) {
+  bool found = false;
+  for (const auto& m : *msgs) {
+    if (Coalescable(*m, with_context)) {
+      found = true;
+      break;
+    }
+  }
+  if (!found) {
+    return ;
+  }
+
+  std::lock_guard<std::mutex> guard(mutex_);
+  for (auto& m : *msgs) {
+    if (!Coalescable(*m, with_context)) {
+      continue;
+    }
+
+    raftpb::HeartbeatBatch* batch = Batch(m->to());
+    raftpb::GroupHeartbeat* heartbeat = raftpb::MsgHeartbeat == m->type() ?
+                                        batch->add_heartbeats() : batch->add_responses();
+    heartbeat->set_groupid(group_id);
+    heartbeat->set_from(m->from());
+    heartbeat->set_to(m->to());
+    heartbeat->set_term(m->term());
+    heartbeat->set_commit(m->commit());
+    heartbeat->set_context(m->context());
+    m.reset(nullptr);
+  }
+
+  msgs->erase(std::remove(msgs->begin(), msgs->end(), nullptr), msgs->end());
+}
+
+void HeartbeatCoalescer::Quiesce(uint64_t group_id, uint64_t from, uint64_t to,
+                                 uint64_t term, uint64_t commit) {
+  std::lock_guard<std::mutex> guard(mutex_);
+  raftpb::GroupHeartbeat* heartbeat = Batch(to)->add_heartbeats();
+  heartbeat->set_groupid(group_id);
+  heartbeat->set_from(from);
+  heartbeat->set_to(to);
+  heartbeat->set_term(term);
+  heartbeat->set_commit(commit);
+  heartbeat->set_quiesce(true);
+}
+
+void HeartbeatCoalescer::Flush(std::vector<raftpb::HeartbeatBatch>* batches) {
+  std::map<uint64_t, raftpb::HeartbeatBatch> pending;
+  {
+    std::lock_guard<std::mutex> guard(mutex_);
+    pending.swap(pending_);
+  }
+
+  for (auto& batch : pending) {
+    batches->push_back(std::move(batch.second));
+  }
+}
+
+void HeartbeatCoalescer::Expand(const raftpb::HeartbeatBatch& batch, GroupMessages* msgs,
+                                std::vector<raftpb::GroupHeartbeat>* quiesces) {
+  for (const auto& heartbeat : batch.heartbeats()) {
+    if (heartbeat.quiesce()) {
+      quiesces->push_back(heartbeat);
+      continue;
+    }
+
+    std::unique_ptr<raftpb::Message> m(new raftpb::Message);
+    m->set_type(raftpb::MsgHeartbeat);
+    m->set_from(heartbeat.from());
+    m->set_to(heartbeat.to());
+    m->set_term(heartbeat.term());
+    m->set_commit(heartbeat.commit());
+    m->set_context(heartbeat.context());
+    msgs->emplace_back(heartbeat.groupid(), std::move(m));
+  }
+
+  for (const auto& response : batch.responses()) {
+    std::unique_ptr<raftpb::Message> m(new raftpb::Message);
+    m->set_type(raftpb::MsgHeartbeatResp);
+    m->set_from(response.from());
+    m->set_to(response.to());
+    m->set_term(response.term());
+    m->set_context(response.context());
+    msgs->emplace_back(response.groupid(), std::move(m));
+  }
+}
+
+raftpb::HeartbeatBatch* HeartbeatCoalescer::Batch(uint64_t to) {
+  raftpb::HeartbeatBatch& batch = pending_[to];
+  batch.set_from(kNodeId);
+  batch.set_to(to);
+  return &batch;
+}
+
+bool HeartbeatCoalescer::Coalescable(const raftpb::Message& m, bool with_context) {
+  return (raftpb::MsgHeartbeat == m.type() || raftpb::MsgHeartbeatResp == m.type()) &&
+         (with_context || m.context().empty());
+}
+
+} // namespace myraft
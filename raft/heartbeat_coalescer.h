@@ -0,0 +1,64 @@
+#ifndef MYRAFT_HEARTBEAT_COALESCER_H_
+#define MYRAFT_HEARTBEAT_COALESCER_H_
+
+#include <stdint.h>
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "raft.h"
+#include "raftpb/raft.pb.h"
+
+namespace myraft {
+
+// HeartbeatCoalescer merges the MsgHeartbeat and MsgHeartbeatResp of all the
+// groups on this node that are bound for the same peer node into a single
+// HeartbeatBatch, so background traffic scales with nodes rather than with
+// groups. Replica ids are node ids. The context of a heartbeat names its
+// read index round and travels with it, so periodic heartbeats of a lease
+// or of a pending round are coalesced too. A heartbeat that starts a round
+// for waiting reads is left alone, delaying it would delay the reads.
+class HeartbeatCoalescer {
+ public:
+  using GroupMessages = std::vector<std::pair<uint64_t, std::unique_ptr<raftpb::Message>>>;
+
+ public:
+  HeartbeatCoalescer(uint64_t node_id) : kNodeId(node_id) {}
+  ~HeartbeatCoalescer() = default;
+
+  HeartbeatCoalescer(const HeartbeatCoalescer&)            = delete;
+  HeartbeatCoalescer& operator=(const HeartbeatCoalescer&) = delete;
+  HeartbeatCoalescer(HeartbeatCoalescer&&)                 = delete;
+  HeartbeatCoalescer& operator=(HeartbeatCoalescer&&)      = delete;
+
+  // thread-safe, takes the coalescable heartbeats of group_id out of msgs.
+  // with_context takes those carrying a context too, for messages that are
+  // in no more of a hurry than the next flush.
+  void Extract(uint64_t group_id, Raft::Messages* msgs, bool with_context = false);
+  // thread-safe, queues a heartbeat telling to that the group may quiesce.
+  void Quiesce(uint64_t group_id, uint64_t from, uint64_t to, uint64_t term, uint64_t commit);
+  // thread-safe, moves out one batch per destination node.
+  void Flush(std::vector<raftpb::HeartbeatBatch>* batches);
+
+  // turns a received batch back into per group messages, quiesce heartbeats
+  // are not messages of their own and go to quiesces.
+  static void Expand(const raftpb::HeartbeatBatch& batch, GroupMessages* msgs,
+                     std::vector<raftpb::GroupHeartbeat>* quiesces);
+
+ private:
+  static bool Coalescable(const raftpb::Message& m, bool with_context);
+  raftpb::HeartbeatBatch* Batch(uint64_t to);
+
+ private:
+  const uint64_t kNodeId;
+
+  std::mutex mutex_;
+  std::map<uint64_t, raftpb::HeartbeatBatch> pending_;
+}; // class HeartbeatCoalescer
+
+} // namespace myraft
+
+#endif // MYRAFT_HEARTBEAT_COALESCER_H_
@@ -0,0 +1,105 @@
+#include "lease_tracker.h"
+
+#include <stdio.h>
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+
+namespace myraft {
+
+LeaseTracker::LeaseTracker(uint64_t self, uint64_t lease_duration)
+    : kSelf(self),
+      kLeaseDuration(lease_duration),
+      quorum_time_(0) {}
+
+void LeaseTracker::AddVoter(uint64_t id) {
+  if (-1 != Slot(id)) {
+    return ;
+  }
+
+  voters_.push_back(id);
+  times_.push_back(kSelf == id ? std::numeric_limits<uint64_t>::max() : 0);
+  scratch_.resize(times_.size());
+  Recompute();
+}
+
+void LeaseTracker::RemoveVoter(uint64_t id) {
+  int slot = Slot(id);
+  if (-1 == slot) {
+    return ;
+  }
+
+  voters_.erase(voters_.begin() + slot);
+  times_.erase(times_.begin() + slot);
+  scratch_.resize(times_.size());
+  Recompute();
+}
+
+void LeaseTracker::Reset() {
+  for (size_t i = 0; i < voters_.size(); i++) {
+    times_[i] = kSelf == voters_[i] ? std::numeric_limits<uint64_t>::max() : 0;
+  }
+  Recompute();
+}
+
+void LeaseTracker::RecordActive(uint64_t id, uint64_t time) {
+  int slot = Slot(id);
+  if (-1 == slot || times_[slot] >= time) {
+    return ;
+  }
+
+  uint64_t old = times_[slot];
+  times_[slot] = time;
+
+  // raising a time that was above the quorum's can not move it, which is
+  // the common case for all but the slowest voters. A time equal to it may
+  // be the one setting it.
+  if (old <= quorum_time_) {
+    Recompute();
+  }
+}
+
+uint64_t LeaseTracker::LeaseValidUntil() const {
+  if (0 == quorum_time_) {
+    return 0;
+  }
+
+  if (quorum_time_ > std::numeric_limits<uint64_t>::max() - kLeaseDuration) {
+    return std::numeric_limits<uint64_t>::max();
+  }
+  return quorum_time_ + kLeaseDuration;
+}
+
+std::string LeaseTracker::String() const {
+  char buff[1024] = {0};
+  snprintf(buff, 1024, "voters = %lu, quorum_time = %lu, lease_valid_until = %lu",
+           voters_.size(), quorum_time_, LeaseValidUntil());
+  return buff;
+}
+
+int LeaseTracker::Slot(uint64_t id) const {
+  for (size_t i = 0; i < voters_.size(); i++) {
+    if (id == voters_[i]) {
+      return static_cast<int>(i);
+    }
+  }
+
+  return -1;
+}
+
+void LeaseTracker::Recompute() {
+  if (voters_.empty()) {
+    quorum_time_ = 0;
+    return ;
+  }
+
+  // the quorum's active time is the quorum-th largest time.
+  size_t quorum = voters_.size() / 2 + 1;
+  std::copy(times_.begin(), times_.end(), scratch_.begin());
+  std::nth_element(scratch_.begin(), scratch_.begin() + quorum - 1, scratch_.end(),
+                   std::greater<uint64_t>());
+  quorum_time_ = scratch_[quorum - 1];
+}
+
+} // namespace myraft
@@ -0,0 +1,57 @@
+#ifndef MYRAFT_LEASE_TRACKER_H_
+#define MYRAFT_LEASE_TRACKER_H_
+
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+namespace myraft {
+
+// LeaseTracker keeps, for every voter, the latest monotonic time it was known
+// to be active and maintains the time at which a quorum was last active.
+// The leader itself is always active. For the lease to be safe, the recorded
+// time must not be later than the moment the acknowledged request was sent,
+// and lease_duration must be shorter than the election timeout by at least
+// the clock drift bound.
+class LeaseTracker {
+ public:
+  LeaseTracker(uint64_t self, uint64_t lease_duration);
+  ~LeaseTracker() = default;
+
+  LeaseTracker(const LeaseTracker&)            = default;
+  LeaseTracker& operator=(const LeaseTracker&) = default;
+  LeaseTracker(LeaseTracker&&)                 = default;
+  LeaseTracker& operator=(LeaseTracker&&)      = default;
+
+  void AddVoter(uint64_t id);
+  void RemoveVoter(uint64_t id);
+  // forgets every recorded time, e.g. on term change.
+  void Reset();
+
+  void RecordActive(uint64_t id, uint64_t time);
+
+  // 0 if a quorum has never been active.
+  uint64_t QuorumActiveTime() const { return quorum_time_; }
+  uint64_t LeaseValidUntil() const;
+  uint64_t LeaseDuration() const { return kLeaseDuration; }
+  bool LeaseValid(uint64_t now) const { return now < LeaseValidUntil(); }
+
+  std::string String() const;
+
+ private:
+  int Slot(uint64_t id) const;
+  void Recompute();
+
+ private:
+  const uint64_t        kSelf;
+  const uint64_t        kLeaseDuration;
+  std::vector<uint64_t> voters_;
+  std::vector<uint64_t> times_;
+  std::vector<uint64_t> scratch_;
+  uint64_t              quorum_time_;
+}; // class LeaseTracker
+
+} // namespace myraft
+
+#endif // MYRAFT_LEASE_TRACKER_H_
@@ -0,0 +1,126 @@
+#include "message_encoder.h"
+
+#include <zlib.h>
+
+#include <utility>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+
+namespace myraft {
+
+// field 7 (Entries) of raftpb::Message, length delimited.
+static const uint32_t kEntriesTag = (raftpb::Message::kEntriesFieldNumber << 3) | 2;
+
+void EncodedMessage::AppendTo(std::string* frame) const {
+  frame->append(header);
+  if (entries) {
+    frame->append(*entries);
+  }
+}
+
+bool InflateEntries(const char* data, size_t size, uint32_t raw_size, std::string* out) {
+  size_t offset = out->size();
+  out->resize(offset + raw_size);
+
+  uLongf length = raw_size;
+  if (Z_OK != uncompress(reinterpret_cast<Bytef*>(&(*out)[offset]), &length,
+                         reinterpret_cast<const Bytef*>(data), size) ||
+      length != raw_size) {
+    out->resize(offset);
+    return false;
+  }
+  return true;
+}
+
+void MessageEncoder::Encode(uint64_t group_id, raftpb::Message* m, EncodedMessage* encoded,
+                            bool compress) {
+  encoded->header.clear();
+  encoded->entries.reset();
+  encoded->compressed = false;
+  encoded->raw_entries_size = 0;
+
+  if (0 == m->entries_size()) {
+    m->SerializeToString(&encoded->header);
+    return ;
+  }
+
+  CachedRange* range = EncodeEntries(group_id, *m);
+  encoded->entries = range->entries;
+  if (compress && range->entries->size() >= kMinCompressSize) {
+    if (!range->compress_tried) {
+      range->compressed = Compress(*range->entries);
+      range->compress_tried = true;
+    }
+    if (range->compressed) {
+      encoded->entries = range->compressed;
+      encoded->compressed = true;
+      encoded->raw_entries_size = static_cast<uint32_t>(range->entries->size());
+    }
+  }
+
+  google::protobuf::RepeatedPtrField<raftpb::Entry> entries;
+  entries.Swap(m->mutable_entries());
+  m->SerializeToString(&encoded->header);
+  entries.Swap(m->mutable_entries());
+}
+
+void MessageEncoder::Clear() {
+  cache_.clear();
+  next_victim_ = 0;
+}
+
+MessageEncoder::CachedRange* MessageEncoder::EncodeEntries(uint64_t group_id,
+                                                          const raftpb::Message& m) {
+  uint64_t first_index = m.entries(0).index();
+  const raftpb::Entry& last = m.entries(m.entries_size() - 1);
+  for (auto& range : cache_) {
+    if (group_id == range.group_id && first_index == range.first_index &&
+        last.index() == range.last_index && last.term() == range.last_term) {
+      return &range;
+    }
+  }
+
+  // the same bytes SerializeToString writes for the Entries field.
+  std::shared_ptr<std::string> encoded(new std::string);
+  {
+    google::protobuf::io::StringOutputStream stream(encoded.get());
+    google::protobuf::io::CodedOutputStream output(&stream);
+    for (const auto& entry : m.entries()) {
+      size_t size = entry.ByteSizeLong();
+      output.WriteTag(kEntriesTag);
+      output.WriteVarint32(static_cast<uint32_t>(size));
+      entry.SerializeWithCachedSizes(&output);
+    }
+  }
+
+  CachedRange range{group_id, first_index, last.index(), last.term(), encoded, nullptr, false};
+  if (cache_.size() < kCacheSize) {
+    cache_.push_back(std::move(range));
+    return &cache_.back();
+  }
+
+  size_t victim = next_victim_;
+  cache_[victim] = std::move(range);
+  next_victim_ = (next_victim_ + 1) % kCacheSize;
+  return &cache_[victim];
+}
+
+std::shared_ptr<const std::string> MessageEncoder::Compress(const std::string& raw) {
+  std::shared_ptr<std::string> compressed(new std::string);
+  compressed->resize(compressBound(raw.size()));
+
+  uLongf length = compressed->size();
+  // replication is bandwidth bound, but the leader still pays this for every
+  // range, the fastest level keeps most of the gain on text.
+  if (Z_OK != compress2(reinterpret_cast<Bytef*>(&(*compressed)[0]), &length,
+                        reinterpret_cast<const Bytef*>(raw.data()), raw.size(), Z_BEST_SPEED) ||
+      length >= raw.size()) {
+    return nullptr;
+  }
+
+  compressed->resize(length);
+  return compressed;
+}
+
+} // namespace myraft
@@ -0,0 +1,94 @@
+#ifndef MYRAFT_MESSAGE_ENCODER_H_
+#define MYRAFT_MESSAGE_ENCODER_H_
+
+#include <stdint.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "raftpb/raft.pb.h"
+
+namespace myraft {
+
+// EncodedMessage is the wire form of a raftpb::Message split in two: the
+// per-peer header and the encoded Entries field, which is shared by every
+// MsgApp carrying the same entry range. header + *entries parses back as the
+// original message since repeated fields of concatenated messages append.
+//
+// If compressed, entries holds the zlib deflated Entries field, which
+// inflates back to raw_entries_size bytes, and header + *entries is not a
+// message until it is inflated.
+struct EncodedMessage {
+  std::string                        header;
+  // nullptr if the message has no entries.
+  std::shared_ptr<const std::string> entries;
+  bool                               compressed;
+  uint32_t                           raw_entries_size;
+
+  EncodedMessage() : compressed(false), raw_entries_size(0) {}
+
+  size_t Size() const { return header.size() + (entries ? entries->size() : 0); }
+  // the wire form of an uncompressed message.
+  void AppendTo(std::string* frame) const;
+}; // struct EncodedMessage
+
+// inflates the entries of a compressed EncodedMessage, which are appended
+// to out, returns false if they are corrupt.
+bool InflateEntries(const char* data, size_t size, uint32_t raw_size, std::string* out);
+
+// MessageEncoder serializes messages, encoding each entry range only once no
+// matter how many followers it is sent to. Ranges are keyed by their group,
+// first index, last index and last term, by the log matching property the
+// last entry's index and term identify all entries before it within a group.
+// Different groups sit at the same indexes and terms all the time.
+//
+// Compression of an entry range is likewise tried once and cached. Ranges
+// below kMinCompressSize are never compressed, and the compressed form is
+// only used when it is actually smaller.
+class MessageEncoder {
+ public:
+  static const size_t kCacheSize = 8;
+  static const size_t kMinCompressSize = 1024;
+
+ public:
+  MessageEncoder() : next_victim_(0) {}
+  ~MessageEncoder() = default;
+
+  MessageEncoder(const MessageEncoder&)            = delete;
+  MessageEncoder& operator=(const MessageEncoder&) = delete;
+  MessageEncoder(MessageEncoder&&)                 = delete;
+  MessageEncoder& operator=(MessageEncoder&&)      = delete;
+
+  // m of group_id is unchanged on return, its entries are moved out and
+  // back while the header is serialized. compress asks for compressed
+  // entries if they pay.
+  void Encode(uint64_t group_id, raftpb::Message* m, EncodedMessage* encoded,
+              bool compress = false);
+
+  void Clear();
+
+ private:
+  struct CachedRange {
+    uint64_t group_id;
+    uint64_t first_index;
+    uint64_t last_index;
+    uint64_t last_term;
+    std::shared_ptr<const std::string> entries;
+    // nullptr if not tried yet or not worth it.
+    std::shared_ptr<const std::string> compressed;
+    bool compress_tried;
+  }; // struct CachedRange
+
+  // the cached range of m's entries, valid until the next call.
+  CachedRange* EncodeEntries(uint64_t group_id, const raftpb::Message& m);
+  static std::shared_ptr<const std::string> Compress(const std::string& raw);
+
+ private:
+  std::vector<CachedRange> cache_;
+  size_t next_victim_;
+}; // class MessageEncoder
+
+} // namespace myraft
+
+#endif // MYRAFT_MESSAGE_ENCODER_H_
@@ -0,0 +1,439 @@
+#include "multi_raft.h"
+
+#include <stdlib.h>
+
+#include <utility>
+
+namespace myraft {
+
+MultiRaft::MultiRaft(uint64_t node_id, size_t workers, Handler* handler,
+                     size_t max_inbox, size_t max_proposals)
+    : kWorkers(workers),
+      handler_(handler),
+      coalescer_(node_id),
+      inbox_(myutil::MakeBoundedChannel<Inbound>(max_inbox)),
+      proposals_(myutil::MakeBoundedChannel<Proposal>(max_proposals)),
+      dispatch_(false),
+      stopping_(false) {
+  if (!inbox_ || !proposals_) {
+    //Panicf, out of eventfds
+    abort();
+  }
+}
+
+MultiRaft::~MultiRaft() {
+  Stop();
+
+  std::unique_ptr<myutil::Queue<Inbound>> inbox = inbox_->Read();
+  while (!inbox->Empty()) {
+    delete inbox->Pop().m;
+  }
+}
+
+void MultiRaft::Start() {
+  std::lock_guard<std::mutex> guard(run_mutex_);
+  if (!workers_.empty()) {
+    return ;
+  }
+
+  stopping_ = false;
+  for (size_t i = 0; i < kWorkers; i++) {
+    workers_.emplace_back(&MultiRaft::WorkerLoop, this);
+  }
+}
+
+void MultiRaft::Stop() {
+  {
+    std::lock_guard<std::mutex> guard(run_mutex_);
+    stopping_ = true;
+  }
+  run_cond_.notify_all();
+
+  for (auto& worker : workers_) {
+    worker.join();
+  }
+  workers_.clear();
+}
+
+void MultiRaft::SetInboxWatermarks(size_t high, size_t low, Callback on_high, Callback on_low) {
+  inbox_->SetWatermarks(high, low, std::move(on_high), std::move(on_low));
+}
+
+bool MultiRaft::AddGroup(uint64_t group_id, const Config& config) {
+  std::lock_guard<std::mutex> guard(groups_mutex_);
+  if (groups_.end() != groups_.find(group_id)) {
+    return false;
+  }
+
+  groups_.emplace(group_id, std::make_shared<Group>(group_id, config));
+  return true;
+}
+
+void MultiRaft::RemoveGroup(uint64_t group_id) {
+  std::lock_guard<std::mutex> guard(groups_mutex_);
+  auto iter = groups_.find(group_id);
+  if (groups_.end() == iter) {
+    return ;
+  }
+
+  // a worker may still hold the group, it drops it once it sees the flag.
+  iter->second->removed = true;
+  groups_.erase(iter);
+}
+
+size_t MultiRaft::Size() {
+  std::lock_guard<std::mutex> guard(groups_mutex_);
+  return groups_.size();
+}
+
+void MultiRaft::Tick() {
+  // heartbeats produced by the previous tick go out as one batch per node.
+  std::vector<raftpb::HeartbeatBatch> batches;
+  coalescer_.Flush(&batches);
+  for (auto& batch : batches) {
+    handler_->SendHeartbeats(&batch);
+  }
+
+  std::vector<std::shared_ptr<Group>> groups;
+  {
+    std::lock_guard<std::mutex> guard(groups_mutex_);
+    groups.reserve(groups_.size());
+    for (const auto& group : groups_) {
+      groups.push_back(group.second);
+    }
+  }
+
+  for (const auto& group : groups) {
+    if (group->quiesced) {
+      continue;
+    }
+
+    {
+      std::lock_guard<myutil::SpinLock> guard(group->lock);
+      group->ticks++;
+    }
+    Schedule(group);
+  }
+}
+
+bool MultiRaft::Step(uint64_t group_id, std::unique_ptr<raftpb::Message> m) {
+  if (nullptr == FindGroup(group_id).get()) {
+    return false;
+  }
+
+  if (!inbox_->TryWrite(Inbound{group_id, m.get()})) {
+    //Warningf, inbox is full, dropping message
+    return false;
+  }
+  m.release();
+  Notify();
+  return true;
+}
+
+bool MultiRaft::Step(uint64_t group_id, Raft::Messages* msgs) {
+  if (nullptr == FindGroup(group_id).get()) {
+    msgs->clear();
+    return false;
+  }
+
+  bool full = false;
+  for (auto& m : *msgs) {
+    if (!inbox_->TryWrite(Inbound{group_id, m.get()})) {
+      //Warningf, inbox is full, dropping messages
+      full = true;
+      break;
+    }
+    m.release();
+  }
+  msgs->clear();
+  Notify();
+  return !full;
+}
+
+void MultiRaft::StepHeartbeats(const raftpb::HeartbeatBatch& batch) {
+  HeartbeatCoalescer::GroupMessages msgs;
+  std::vector<raftpb::GroupHeartbeat> quiesces;
+  HeartbeatCoalescer::Expand(batch, &msgs, &quiesces);
+  for (auto& m : msgs) {
+    std::shared_ptr<Group> group = FindGroup(m.first);
+    if (nullptr == group.get()) {
+      continue;
+    }
+
+    {
+      std::lock_guard<myutil::SpinLock> guard(group->lock);
+      group->heartbeats.push_back(std::move(m.second));
+    }
+    Schedule(group);
+  }
+
+  for (auto& quiesce : quiesces) {
+    std::shared_ptr<Group> group = FindGroup(quiesce.groupid());
+    if (nullptr == group.get()) {
+      continue;
+    }
+
+    {
+      std::lock_guard<myutil::SpinLock> guard(group->lock);
+      group->quiesces.push_back(std::move(quiesce));
+    }
+    Schedule(group);
+  }
+}
+
+void MultiRaft::ReportNodeDown(uint64_t node_id) {
+  std::lock_guard<std::mutex> guard(groups_mutex_);
+  for (const auto& group : groups_) {
+    if (node_id == group.second->lead) {
+      group.second->quiesced = false;
+    }
+  }
+}
+
+bool MultiRaft::Propose(uint64_t group_id, std::string data) {
+  if (nullptr == FindGroup(group_id).get()) {
+    return false;
+  }
+
+  if (!proposals_->TryWrite(Proposal{group_id, std::move(data)})) {
+    return false;
+  }
+  Notify();
+  return true;
+}
+
+bool MultiRaft::ReadIndex(uint64_t group_id, std::string ctx) {
+  std::shared_ptr<Group> group = FindGroup(group_id);
+  if (nullptr == group.get()) {
+    return false;
+  }
+
+  {
+    std::lock_guard<myutil::SpinLock> guard(group->lock);
+    group->reads.push_back(std::move(ctx));
+  }
+  Schedule(group);
+  return true;
+}
+
+std::shared_ptr<MultiRaft::Group> MultiRaft::FindGroup(uint64_t group_id) {
+  std::lock_guard<std::mutex> guard(groups_mutex_);
+  auto iter = groups_.find(group_id);
+  if (groups_.end() == iter) {
+    return nullptr;
+  }
+
+  return iter->second;
+}
+
+void MultiRaft::Schedule(const std::shared_ptr<Group>& group) {
+  if (group->scheduled.exchange(true)) {
+    return ;
+  }
+
+  {
+    std::lock_guard<std::mutex> guard(run_mutex_);
+    run_queue_.push_back(group);
+  }
+  run_cond_.notify_one();
+}
+
+void MultiRaft::Notify() {
+  if (dispatch_.exchange(true)) {
+    return ;
+  }
+
+  // a worker checks dispatch_ with run_mutex_ held before it waits.
+  {
+    std::lock_guard<std::mutex> guard(run_mutex_);
+  }
+  run_cond_.notify_one();
+}
+
+void MultiRaft::Dispatch() {
+  std::unique_ptr<myutil::Queue<Inbound>> inbox = inbox_->Read(kMaxDispatch);
+  std::unique_ptr<myutil::Queue<Proposal>> proposals = proposals_->Read(kMaxDispatch);
+
+  // a batch mostly belongs to a few groups.
+  std::unordered_map<uint64_t, std::shared_ptr<Group>> groups;
+  auto find = [this, &groups](uint64_t group_id) {
+    auto iter = groups.find(group_id);
+    if (groups.end() == iter) {
+      iter = groups.emplace(group_id, FindGroup(group_id)).first;
+    }
+    return iter->second.get();
+  };
+
+  while (!inbox->Empty()) {
+    Inbound inbound = inbox->Pop();
+    std::unique_ptr<raftpb::Message> m(inbound.m);
+    Group* group = find(inbound.group_id);
+    if (nullptr != group) {
+      std::lock_guard<myutil::SpinLock> guard(group->lock);
+      group->inbox.push_back(std::move(m));
+    }
+  }
+  while (!proposals->Empty()) {
+    Proposal proposal = proposals->Pop();
+    Group* group = find(proposal.group_id);
+    if (nullptr != group) {
+      std::lock_guard<myutil::SpinLock> guard(group->lock);
+      group->proposals.push_back(std::move(proposal.data));
+    }
+  }
+
+  for (const auto& group : groups) {
+    if (nullptr != group.second.get()) {
+      Schedule(group.second);
+    }
+  }
+  if (0 != inbox_->Size() || 0 != proposals_->Size()) {
+    Notify();
+  }
+}
+
+void MultiRaft::WorkerLoop() {
+  while (true) {
+    std::shared_ptr<Group> group;
+    {
+      std::unique_lock<std::mutex> lock(run_mutex_);
+      run_cond_.wait(lock, [this] { return stopping_ || !run_queue_.empty() || dispatch_; });
+      if (stopping_) {
+        return ;
+      }
+      // the channels are only drained while every worker may find a group
+      // to run, so a backlog waits there rather than in the groups.
+      if (dispatch_ && run_queue_.size() < kWorkers) {
+        dispatch_ = false;
+        lock.unlock();
+        Dispatch();
+        continue;
+      }
+
+      group = std::move(run_queue_.front());
+      run_queue_.pop_front();
+    }
+
+    bool has_ready = false;
+    if (!group->removed) {
+      has_ready = Process(group.get());
+    }
+
+    // work queued while we were processing found the group scheduled and did
+    // not requeue it, so check again after clearing the flag.
+    group->scheduled = false;
+    if (!group->removed && (has_ready || HasWork(group.get()))) {
+      Schedule(group);
+    }
+  }
+}
+
+bool MultiRaft::Process(Group* group) {
+  int ticks = 0;
+  Raft::Messages inbox;
+  Raft::Messages heartbeats;
+  std::vector<std::string> proposals;
+  std::vector<std::string> reads;
+  std::vector<raftpb::GroupHeartbeat> quiesces;
+  {
+    std::lock_guard<myutil::SpinLock> guard(group->lock);
+    ticks = group->ticks;
+    group->ticks = 0;
+    inbox.swap(group->inbox);
+    heartbeats.swap(group->heartbeats);
+    proposals.swap(group->proposals);
+    reads.swap(group->reads);
+    quiesces.swap(group->quiesces);
+  }
+
+  // nothing but ticks and coalesced heartbeats, whatever heartbeats this
+  // produces can wait for the next flush too.
+  bool periodic = inbox.empty() && proposals.empty() && reads.empty();
+  for (auto& m : heartbeats) {
+    inbox.push_back(std::move(m));
+  }
+
+  // heartbeat responses keep flowing to a quiesced leader, they are no
+  // reason to wake up.
+  bool wake = !proposals.empty() || !reads.empty();
+  for (const auto& m : inbox) {
+    if (raftpb::MsgHeartbeatResp != m->type()) {
+      wake = true;
+      break;
+    }
+  }
+  if (wake) {
+    group->quiesced = false;
+  }
+
+  RawNode* node = group->node.get();
+  for (int i = 0; i < ticks; i++) {
+    node->Tick();
+  }
+  if (!inbox.empty()) {
+    node->StepBatch(&inbox);
+  }
+  for (auto& data : proposals) {
+    Raft::Error error = node->Propose(data);
+    if (Raft::OK != error) {
+      handler_->ReportProposal(group->id, std::move(data), error);
+    }
+  }
+  for (const auto& ctx : reads) {
+    node->ReadIndex(ctx);
+  }
+
+  Raft* raft = node->GetRaft();
+  for (const auto& quiesce : quiesces) {
+    std::unique_ptr<raftpb::Message> m(new raftpb::Message);
+    m->set_type(raftpb::MsgHeartbeat);
+    m->set_from(quiesce.from());
+    m->set_to(quiesce.to());
+    m->set_term(quiesce.term());
+    m->set_commit(quiesce.commit());
+    node->Step(std::move(m));
+
+    // only follow a leader we agree with on everything.
+    if (quiesce.from() == raft->Lead() && quiesce.term() == raft->Term() &&
+        quiesce.commit() == raft->Log()->Committed() &&
+        quiesce.commit() == raft->Log()->LastIndex()) {
+      group->quiesced = true;
+    }
+  }
+
+  if (node->HasReady()) {
+    Ready rd;
+    node->GetReady(&rd);
+    coalescer_.Extract(group->id, &rd.messages, periodic);
+    handler_->HandleReady(group->id, node, &rd);
+    node->Advance(rd);
+  }
+
+  MaybeQuiesce(group);
+  group->lead = raft->Lead();
+  return node->HasReady();
+}
+
+void MultiRaft::MaybeQuiesce(Group* group) {
+  RawNode* node = group->node.get();
+  Raft* raft = node->GetRaft();
+  if (group->quiesced || node->HasReady() || !raft->CanQuiesce()) {
+    return ;
+  }
+
+  for (const auto& pr : raft->Progresses()) {
+    if (raft->Id() != pr.first) {
+      coalescer_.Quiesce(group->id, raft->Id(), pr.first, raft->Term(), raft->Log()->Committed());
+    }
+  }
+  group->quiesced = true;
+}
+
+bool MultiRaft::HasWork(Group* group) {
+  std::lock_guard<myutil::SpinLock> guard(group->lock);
+  return group->ticks > 0 || !group->inbox.empty() || !group->heartbeats.empty() ||
+         !group->proposals.empty() || !group->reads.empty() ||
+         !group->quiesces.empty();
+}
+
+} // namespace myraft
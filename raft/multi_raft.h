@@ -0,0 +1,187 @@
+#ifndef MYRAFT_MULTI_RAFT_H_
+#define MYRAFT_MULTI_RAFT_H_
+
+#include <stdint.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "heartbeat_coalescer.h"
+#include "rawnode.h"
+#include "raftpb/raft.pb.h"
+
+#include <transport/bounded_channel.h>
+#include <util/spin_lock.h>
+
+namespace myraft {
+
+// MultiRaft hosts many raft groups in one process. Ticks, incoming messages
+// and proposals are queued on their group, and a group is put on the run
+// queue only when it has something queued, so a fixed pool of workers only
+// ever looks at groups with pending work. A group is processed by at most one
+// worker at a time. Heartbeats are coalesced per destination node and handed
+// to the Handler once per Tick. Those carrying a read index context are only
+// coalesced when the group had nothing to do but tick and answer coalesced
+// heartbeats, otherwise they may start a round reads are waiting on.
+//
+// Incoming messages and proposals first wait in bounded channels, which the
+// workers only drain into the groups while few groups wait to run. A node
+// that falls behind thus refuses them rather than queueing without limit,
+// and the inbox watermarks let a transport stop reading in the meantime.
+//
+// A leader with nothing left to replicate quiesces its group: it sends a
+// quiesce heartbeat to every follower and the group is no longer ticked on
+// any replica until a proposal, a read or a message other than a heartbeat
+// response wakes it. Followers rely on ReportNodeDown to learn that the
+// leader of a quiesced group went away.
+class MultiRaft {
+ public:
+  class Handler {
+   public:
+    Handler()          = default;
+    virtual ~Handler() = default;
+
+    // called on a worker thread, persist, send and apply rd before returning
+    // (see RawNode for what may overlap the write), the group is advanced
+    // right after.
+    virtual void HandleReady(uint64_t group_id, RawNode* node, Ready* rd) = 0;
+    // sends the coalesced heartbeats of many groups to node batch->to().
+    virtual void SendHeartbeats(raftpb::HeartbeatBatch* batch) = 0;
+    // called on a worker thread with a proposal this node refused, e.g.
+    // ErrProposalTooLarge while too many bytes are uncommitted, or
+    // ErrProposalDropped without a leader. A proposal forwarded to the
+    // leader may still be dropped there without a report.
+    virtual void ReportProposal(uint64_t group_id, std::string data, Raft::Error error) = 0;
+  }; // class Handler
+
+  using Callback = std::function<void()>;
+
+  // messages and proposals waiting to be handed to their groups.
+  static const size_t kMaxInbox     = 1 << 16;
+  static const size_t kMaxProposals = 1 << 16;
+  // taken off each channel by one worker at a time.
+  static const size_t kMaxDispatch  = 1024;
+
+ public:
+  MultiRaft(uint64_t node_id, size_t workers, Handler* handler,
+            size_t max_inbox = kMaxInbox, size_t max_proposals = kMaxProposals);
+  ~MultiRaft();
+
+  MultiRaft(const MultiRaft&)            = delete;
+  MultiRaft& operator=(const MultiRaft&) = delete;
+  MultiRaft(MultiRaft&&)                 = delete;
+  MultiRaft& operator=(MultiRaft&&)      = delete;
+
+  void Start();
+  void Stop();
+
+  // before Start. on_high runs once high messages wait in the inbox, on_low
+  // once they are down to low again, see BoundedChannel. A transport feeding
+  // Step would pause and resume reading.
+  void SetInboxWatermarks(size_t high, size_t low, Callback on_high, Callback on_low);
+
+  bool AddGroup(uint64_t group_id, const Config& config);
+  void RemoveGroup(uint64_t group_id);
+  size_t Size();
+
+  // the calls below are thread-safe and only queue work on the group,
+  // false if the group does not exist.
+  void Tick();
+  // also false if the inbox is full, m is dropped then.
+  bool Step(uint64_t group_id, std::unique_ptr<raftpb::Message> m);
+  // queues a batch of one group at once, as a transport hands it over. msgs
+  // is left empty, whatever did not fit in the inbox is dropped.
+  bool Step(uint64_t group_id, Raft::Messages* msgs);
+  void StepHeartbeats(const raftpb::HeartbeatBatch& batch);
+  // wakes the quiesced groups led by node_id, so that they elect a new leader.
+  void ReportNodeDown(uint64_t node_id);
+  // a refused proposal is handed back through Handler::ReportProposal.
+  // false right away if too many proposals are queued, try again later.
+  bool Propose(uint64_t group_id, std::string data);
+  bool ReadIndex(uint64_t group_id, std::string ctx);
+
+ private:
+  struct Group {
+    Group(uint64_t group_id, const Config& config)
+        : id(group_id), node(new RawNode(config)),
+          ticks(0), scheduled(false), removed(false),
+          quiesced(false), lead(kNone) {}
+
+    const uint64_t           id;
+    std::unique_ptr<RawNode> node;
+
+    // guards the queued work below.
+    myutil::SpinLock         lock;
+    Raft::Messages           inbox;
+    // from StepHeartbeats.
+    Raft::Messages           heartbeats;
+    std::vector<std::string> proposals;
+    std::vector<std::string> reads;
+    std::vector<raftpb::GroupHeartbeat> quiesces;
+    int                      ticks;
+
+    // true while the group is on the run queue or being processed.
+    std::atomic<bool>        scheduled;
+    std::atomic<bool>        removed;
+    // not ticked while quiesced.
+    std::atomic<bool>        quiesced;
+    // leader as of the last time the group was processed.
+    std::atomic<uint64_t>    lead;
+  }; // struct Group
+
+  // a message waiting in the inbox, owned.
+  struct Inbound {
+    uint64_t         group_id;
+    raftpb::Message* m;
+  }; // struct Inbound
+
+  struct Proposal {
+    uint64_t    group_id;
+    std::string data;
+  }; // struct Proposal
+
+  std::shared_ptr<Group> FindGroup(uint64_t group_id);
+  void Schedule(const std::shared_ptr<Group>& group);
+  // wakes a worker to drain the channels.
+  void Notify();
+  // hands a batch of the channels to their groups.
+  void Dispatch();
+  void WorkerLoop();
+  // returns true iff the group has more ready work.
+  bool Process(Group* group);
+  void MaybeQuiesce(Group* group);
+  static bool HasWork(Group* group);
+
+ private:
+  const size_t kWorkers;
+  Handler*     handler_;
+
+  HeartbeatCoalescer coalescer_;
+
+  std::unique_ptr<myutil::BoundedChannel<Inbound>>  inbox_;
+  std::unique_ptr<myutil::BoundedChannel<Proposal>> proposals_;
+
+  std::mutex groups_mutex_;
+  std::unordered_map<uint64_t, std::shared_ptr<Group>> groups_;
+
+  std::mutex              run_mutex_;
+  std::condition_variable run_cond_;
+  std::deque<std::shared_ptr<Group>> run_queue_;
+  // the channels got something since a worker last drained them.
+  std::atomic<bool>       dispatch_;
+  bool                    stopping_;
+
+  std::vector<std::thread> workers_;
+}; // class MultiRaft
+
+} // namespace myraft
+
+#endif // MYRAFT_MULTI_RAFT_H_
@@ -15,7 +15,7 @@ Progress::Progress(uint64_t match,
       state_(ProgressStateProbe),
       paused_(false),
       pending_snapshot_(0),
-      recent_active_(false),
+      recent_active_time_(0),
       inflights_(max_inflight),
       is_learner_(is_learner) {}
 
@@ -89,6 +89,21 @@ bool Progress::MaybeDecrease(uint64_t rejected, uint64_t last) {
   return true;
 }
 
+void Progress::SentAppend(uint64_t last) {
+  switch (state_) {
+    case ProgressStateReplicate:
+      OptimisticUpdate(last);
+      inflights_.Push(last);
+      break;
+    case ProgressStateProbe:
+      Pause();
+      break;
+    default:
+      //Panicf
+      break;
+  }
+}
+
 bool Progress::IsPaused() const {
   switch (state_) {
     case ProgressStateProbe:
@@ -126,8 +141,8 @@ std::string Progress::String() const {
   return buff;
 }
 
-bool Progress::ProgressAppResp(const std::unique_ptr<const raftpb::Message>& m) {
-  recent_active_ = true;
+bool Progress::ProgressAppResp(const std::unique_ptr<const raftpb::Message>& m, uint64_t now) {
+  recent_active_time_ = std::max(recent_active_time_, now);
 
   if (m->reject()) {
     if (MaybeDecrease(m->index(), m->rejecthint())) {
@@ -158,10 +173,10 @@ bool Progress::ProgressAppResp(const std::unique_ptr<const raftpb::Message>& m)
   return false;
 }
 
-void Progress::ProgressHeartbeatResp(const std::unique_ptr<const raftpb::Message>& m) {
+void Progress::ProgressHeartbeatResp(const std::unique_ptr<const raftpb::Message>& m, uint64_t now) {
   (void)m;
 
-  recent_active_ = true;
+  recent_active_time_ = std::max(recent_active_time_, now);
   Resume();
 
   if (ProgressStateReplicate == state_ && inflights_.Full()) {
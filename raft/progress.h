@@ -27,6 +27,12 @@ class Progress {
   Progress(Progress&&)                 = default;
   Progress& operator=(Progress&&)      = default;
 
+  uint64_t      Match()     const { return match_; }
+  uint64_t      Next()      const { return next_; }
+  ProgressState State()     const { return state_; }
+  bool          IsLearner() const { return is_learner_; }
+  void SetLearner(bool is_learner)  { is_learner_ = is_learner; }
+
   void BecomeProbe();
   void BecomeReplicate();
   void BecomeSnapshot(uint64_t snapshot_index);
@@ -34,6 +40,8 @@ class Progress {
   bool MaybeUpdate(uint64_t index);
   bool MaybeDecrease(uint64_t rejected, uint64_t last);
   void OptimisticUpdate(uint64_t index) { next_ = index + 1; }
+  // entries up to last have been sent in a MsgApp.
+  void SentAppend(uint64_t last);
 
   void Pause()  { paused_ = true; }
   void Resume() { paused_ = false; }
@@ -43,11 +51,17 @@ class Progress {
   bool NeedSnapshotAbort() const
   { return ProgressStateSnapshot == state_ && match_ >= pending_snapshot_; }
 
-  bool ProgressAppResp(const std::unique_ptr<const raftpb::Message>& m);
-  void ProgressHeartbeatResp(const std::unique_ptr<const raftpb::Message>& m);
+  // now is the monotonic time (see myutil::MonotonicMicros) the response is handled at.
+  bool ProgressAppResp(const std::unique_ptr<const raftpb::Message>& m, uint64_t now);
+  void ProgressHeartbeatResp(const std::unique_ptr<const raftpb::Message>& m, uint64_t now);
   void ProgressSnapStatus(const std::unique_ptr<const raftpb::Message>& m);
   void ProgressUnreachable(const std::unique_ptr<const raftpb::Message>& m);
 
+  // true iff the follower responded at or after since.
+  bool RecentActive(uint64_t since) const { return recent_active_time_ >= since; }
+  uint64_t RecentActiveTime() const       { return recent_active_time_; }
+  void SetRecentActiveTime(uint64_t time) { recent_active_time_ = time; }
+
   std::string String() const;
 
  private:
@@ -79,7 +93,7 @@ class Progress {
   ProgressState state_;
   bool          paused_;
   uint64_t      pending_snapshot_;
-  bool          recent_active_;
+  uint64_t      recent_active_time_;
   Inflights     inflights_;
   bool          is_learner_;
 }; // class Progress
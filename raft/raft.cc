@@ -0,0 +1,1333 @@
+#include "raft.h"
+
+#include <stdio.h>
+
+#include <algorithm>
+#include <functional>
+#include <utility>
+
+#include <util/util.h>
+
+namespace myraft {
+
+static const std::string kCampaignPreElection = "CampaignPreElection";
+static const std::string kCampaignElection    = "CampaignElection";
+static const std::string kCampaignTransfer    = "CampaignTransfer";
+
+static const char* StateString(StateType state) {
+  static const char* kStateStrings[] = {
+    "StateFollower",
+    "StateCandidate",
+    "StateLeader",
+    "StatePreCandidate",
+  };
+
+  return kStateStrings[state];
+}
+
+static bool IsHardStateEmpty(const raftpb::HardState& state) {
+  return 0 == state.term() && 0 == state.vote() && 0 == state.commit();
+}
+
+Raft::Raft(const Config& config)
+    : id_(config.id),
+      term_(0),
+      vote_(kNone),
+      raft_log_(NewRaftLog(config.storage)),
+      max_size_per_msg_(config.max_size_per_msg),
+      // no room for a single MsgApp would pause every follower for good.
+      max_inflight_(config.max_inflight_msgs > 0 ? config.max_inflight_msgs : 1),
+      is_learner_(false),
+      state_(StateFollower),
+      lead_(kNone),
+      lead_transferee_(kNone),
+      lease_revoked_(false),
+      pending_conf_index_(0),
+      // a lease is only honored by followers that check the quorum, see below.
+      kReadOnlyOption(config.check_quorum ? config.read_only_option : ReadOnly::ReadOnlySafe),
+      election_elapsed_(0),
+      heartbeat_elapsed_(0),
+      check_quorum_(config.check_quorum),
+      pre_vote_(config.pre_vote),
+      heartbeat_timeout_(config.heartbeat_tick),
+      election_timeout_(config.election_tick),
+      tick_interval_(config.tick_interval),
+      max_clock_drift_(config.max_clock_drift),
+      randomized_election_timeout_(config.election_tick),
+      random_(config.id ^ myutil::MonotonicMicros()),
+      step_(&Raft::StepFollower),
+      tick_leader_(false),
+      batch_depth_(0),
+      now_(myutil::MonotonicMicros()),
+      maybe_commit_(false),
+      max_proposal_batch_bytes_(config.max_proposal_batch_bytes),
+      proposal_batch_window_(config.proposal_batch_window),
+      pending_props_bytes_(0),
+      pending_props_since_(0),
+      max_uncommitted_size_(config.max_uncommitted_size),
+      uncommitted_size_(0) {
+  if (kNone == id_ || heartbeat_timeout_ <= 0 || election_timeout_ <= heartbeat_timeout_) {
+    //Panicf
+  }
+  if (ReadOnly::ReadOnlyLeaseBased == config.read_only_option && !check_quorum_) {
+    //Panicf, check_quorum must be enabled when read_only_option is ReadOnlyLeaseBased
+  }
+
+  raftpb::HardState hard_state;
+  raftpb::ConfState conf_state;
+  auto error = config.storage->InitialState(&hard_state, &conf_state);
+  if (Storage::OK != error) {
+    //Panicf
+  }
+
+  std::vector<uint64_t> peers = config.peers;
+  std::vector<uint64_t> learners = config.learners;
+  if (conf_state.nodes_size() > 0 || conf_state.learners_size() > 0) {
+    if (!peers.empty() || !learners.empty()) {
+      //Panicf, cannot specify both Config::peers and ConfState
+    }
+    peers.assign(conf_state.nodes().begin(), conf_state.nodes().end());
+    learners.assign(conf_state.learners().begin(), conf_state.learners().end());
+  }
+
+  for (uint64_t peer : peers) {
+    SetProgress(peer, 0, 1, false);
+  }
+  for (uint64_t learner : learners) {
+    if (prs_.end() != prs_.find(learner)) {
+      //Panicf, node is in both learner and peer list
+    }
+    SetProgress(learner, 0, 1, true);
+    if (id_ == learner) {
+      is_learner_ = true;
+    }
+  }
+
+  if (!IsHardStateEmpty(hard_state)) {
+    LoadState(hard_state);
+  }
+  if (config.applied > 0) {
+    raft_log_->ApplyTo(config.applied);
+  }
+
+  BecomeFollower(term_, kNone);
+}
+
+Raft::Error Raft::Step(std::unique_ptr<raftpb::Message> m) {
+  BeginBatch();
+  now_ = myutil::MonotonicMicros();
+  Error error = StepMessage(std::move(m));
+  EndBatch();
+
+  return error;
+}
+
+size_t Raft::StepBatch(Messages* msgs) {
+  size_t failed = 0;
+
+  BeginBatch();
+  now_ = myutil::MonotonicMicros();
+  for (auto& m : *msgs) {
+    if (OK != StepMessage(std::move(m))) {
+      failed++;
+    }
+  }
+  msgs->clear();
+  EndBatch();
+
+  return failed;
+}
+
+void Raft::Tick() {
+  BeginBatch();
+  now_ = myutil::MonotonicMicros();
+  if (tick_leader_) {
+    TickHeartbeat();
+  } else {
+    TickElection();
+  }
+  EndBatch();
+}
+
+void Raft::BecomeFollower(uint64_t term, uint64_t lead) {
+  step_ = &Raft::StepFollower;
+  Reset(term);
+  tick_leader_ = false;
+  lead_  = lead;
+  state_ = StateFollower;
+  //Infof("%x became follower at term %d", id_, term_)
+}
+
+void Raft::BecomeCandidate() {
+  if (StateLeader == state_) {
+    //Panicf, invalid transition [leader -> candidate]
+  }
+
+  step_ = &Raft::StepCandidate;
+  Reset(term_ + 1);
+  tick_leader_ = false;
+  vote_  = id_;
+  state_ = StateCandidate;
+}
+
+void Raft::BecomePreCandidate() {
+  if (StateLeader == state_) {
+    //Panicf, invalid transition [leader -> pre-candidate]
+  }
+
+  // becoming a pre-candidate changes neither term nor vote.
+  step_ = &Raft::StepCandidate;
+  votes_.clear();
+  tick_leader_ = false;
+  lead_  = kNone;
+  state_ = StatePreCandidate;
+}
+
+void Raft::BecomeLeader() {
+  if (StateFollower == state_) {
+    //Panicf, invalid transition [follower -> leader]
+  }
+
+  step_ = &Raft::StepLeader;
+  Reset(term_);
+  tick_leader_ = true;
+  lead_  = id_;
+  state_ = StateLeader;
+
+  // conservatively treat every entry up to the last one as a pending conf change.
+  pending_conf_index_ = raft_log_->LastIndex();
+
+  google::protobuf::RepeatedPtrField<raftpb::Entry> entries;
+  entries.Add();
+  AppendEntry(&entries);
+  MarkBcastAppend(false);
+}
+
+bool Raft::CanQuiesce() const {
+  if (StateLeader != state_ || kNone != lead_transferee_) {
+    return false;
+  }
+  if (read_only_->HasOpenBatch() || read_only_->PendingRequests() > 0 ||
+      !pending_props_.empty()) {
+    return false;
+  }
+
+  uint64_t last_index = raft_log_->LastIndex();
+  if (raft_log_->Committed() != last_index) {
+    return false;
+  }
+  for (const auto& pr : prs_) {
+    if (pr.second.Match() != last_index) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+void Raft::AddNode(uint64_t id) {
+  AddNodeOrLearnerNode(id, false);
+}
+
+void Raft::AddLearner(uint64_t id) {
+  AddNodeOrLearnerNode(id, true);
+}
+
+void Raft::RemoveNode(uint64_t id) {
+  BeginBatch();
+  DelProgress(id);
+
+  // the quorum size is lowered, so pending entries may be committable now.
+  if (!prs_.empty() && StateLeader == state_) {
+    maybe_commit_ = true;
+    if (lead_transferee_ == id) {
+      AbortLeaderTransfer();
+    }
+  }
+  EndBatch();
+}
+
+raftpb::HardState Raft::GetHardState() const {
+  raftpb::HardState hard_state;
+  hard_state.set_term(term_);
+  hard_state.set_vote(vote_);
+  hard_state.set_commit(raft_log_->Committed());
+  return hard_state;
+}
+
+void Raft::StableTo(uint64_t index, uint64_t term) {
+  raft_log_->StableTo(index, term);
+
+  auto self = prs_.find(id_);
+  if (StateLeader != state_ || prs_.end() == self) {
+    return ;
+  }
+
+  BeginBatch();
+  now_ = myutil::MonotonicMicros();
+  if (self->second.MaybeUpdate(raft_log_->StableIndex())) {
+    maybe_commit_ = true;
+  }
+  EndBatch();
+}
+
+void Raft::TakeMessages(Messages* msgs, Messages* msgs_after_append) {
+  msgs->clear();
+  msgs->swap(msgs_);
+  msgs_after_append->clear();
+  msgs_after_append->swap(msgs_after_append_);
+}
+
+void Raft::TakeReadStates(std::vector<ReadState>* read_states) {
+  read_states->clear();
+  read_states->swap(read_states_);
+}
+
+std::string Raft::String() const {
+  char buff[1024] = {0};
+  snprintf(buff, 1024, "id = %lu, term = %lu, vote = %lu, lead = %lu, state = %s, %s",
+           id_, term_, vote_, lead_, StateString(state_), raft_log_->String().data());
+  return buff;
+}
+
+Raft::Error Raft::StepMessage(std::unique_ptr<raftpb::Message> m) {
+  if (0 == m->term()) {
+    // local message
+  } else if (m->term() > term_) {
+    if (raftpb::MsgVote == m->type() || raftpb::MsgPreVote == m->type()) {
+      bool force = kCampaignTransfer == m->context();
+      bool in_lease = check_quorum_ && kNone != lead_ && election_elapsed_ < election_timeout_;
+      if (!force && in_lease) {
+        // a leader we heard from within the minimum election timeout is
+        // still in charge, do not update term or grant the vote.
+        return OK;
+      }
+    }
+
+    if (raftpb::MsgPreVote == m->type()) {
+      // never change term in response to a PreVote.
+    } else if (raftpb::MsgPreVoteResp == m->type() && !m->reject()) {
+      // the term in a granted PreVoteResp is the one we will campaign with,
+      // it only becomes ours once we win the pre-election.
+    } else {
+      if (raftpb::MsgApp == m->type() || raftpb::MsgHeartbeat == m->type() ||
+          raftpb::MsgSnap == m->type()) {
+        BecomeFollower(m->term(), m->from());
+      } else {
+        BecomeFollower(m->term(), kNone);
+      }
+    }
+  } else if (m->term() < term_) {
+    if ((check_quorum_ || pre_vote_) &&
+        (raftpb::MsgHeartbeat == m->type() || raftpb::MsgApp == m->type())) {
+      // let a leader cut off by a partition learn about the new term, or it
+      // would keep disrupting nothing but itself forever.
+      std::unique_ptr<raftpb::Message> resp(new raftpb::Message);
+      resp->set_to(m->from());
+      resp->set_type(raftpb::MsgAppResp);
+      Send(std::move(resp));
+    } else if (raftpb::MsgPreVote == m->type()) {
+      std::unique_ptr<raftpb::Message> resp(new raftpb::Message);
+      resp->set_to(m->from());
+      resp->set_term(term_);
+      resp->set_type(raftpb::MsgPreVoteResp);
+      resp->set_reject(true);
+      Send(std::move(resp));
+    }
+    return OK;
+  }
+
+  switch (m->type()) {
+    case raftpb::MsgHup: {
+      if (StateLeader == state_) {
+        return OK;
+      }
+
+      google::protobuf::RepeatedPtrField<raftpb::Entry> entries;
+      uint64_t applied = raft_log_->Applied();
+      uint64_t committed = raft_log_->Committed();
+      if (committed > applied) {
+        auto error = raft_log_->Slice(applied + 1, committed + 1, kNoLimit, &entries);
+        if (Storage::OK != error) {
+          //Panicf, unexpected error getting unapplied entries
+        }
+        for (const auto& entry : entries) {
+          if (raftpb::EntryConfChange == entry.type()) {
+            // can not campaign with pending configuration changes to apply.
+            return OK;
+          }
+        }
+      }
+
+      Campaign(pre_vote_ ? kCampaignPreElection : kCampaignElection);
+      return OK;
+    }
+    case raftpb::MsgVote:
+    case raftpb::MsgPreVote: {
+      if (is_learner_) {
+        return OK;
+      }
+
+      bool can_vote = vote_ == m->from() ||
+                      (kNone == vote_ && kNone == lead_) ||
+                      (raftpb::MsgPreVote == m->type() && m->term() > term_);
+      std::unique_ptr<raftpb::Message> resp(new raftpb::Message);
+      resp->set_to(m->from());
+      resp->set_type(VoteRespMsgType(m->type()));
+      if (can_vote && raft_log_->IsUpToData(m->index(), m->logterm())) {
+        // the response carries the term of the request, which for a PreVote
+        // is a future term.
+        resp->set_term(m->term());
+        Send(std::move(resp));
+        if (raftpb::MsgVote == m->type()) {
+          election_elapsed_ = 0;
+          vote_ = m->from();
+        }
+      } else {
+        resp->set_term(term_);
+        resp->set_reject(true);
+        Send(std::move(resp));
+      }
+      return OK;
+    }
+    default:
+      return (this->*step_)(std::move(m));
+  }
+}
+
+Raft::Error Raft::StepLeader(std::unique_ptr<raftpb::Message> m) {
+  switch (m->type()) {
+    case raftpb::MsgBeat:
+      BcastHeartbeat();
+      return OK;
+    case raftpb::MsgCheckQuorum:
+      if (!CheckQuorumActive()) {
+        //Warningf, stepped down to follower since quorum is not active
+        BecomeFollower(term_, kNone);
+      }
+      return OK;
+    case raftpb::MsgProp: {
+      if (0 == m->entries_size()) {
+        //Panicf, stepped empty MsgProp
+      }
+      if (prs_.end() == prs_.find(id_)) {
+        // removed from the configuration while leader.
+        return ErrProposalDropped;
+      }
+      if (kNone != lead_transferee_) {
+        return ErrProposalDropped;
+      }
+
+      uint64_t size = 0;
+      for (int i = 0; i < m->entries_size(); i++) {
+        size += m->entries(i).data().size();
+      }
+      if (!HasUncommittedRoom(size)) {
+        //Debugf, dropping proposal, too many uncommitted bytes
+        return ErrProposalTooLarge;
+      }
+
+      // held proposals are appended ahead of these ones.
+      uint64_t first_index = raft_log_->LastIndex() + pending_props_.size() + 1;
+      for (int i = 0; i < m->entries_size(); i++) {
+        raftpb::Entry* entry = m->mutable_entries(i);
+        if (raftpb::EntryConfChange == entry->type()) {
+          if (pending_conf_index_ > raft_log_->Applied()) {
+            entry->Clear();
+            entry->set_type(raftpb::EntryNormal);
+          } else {
+            pending_conf_index_ = first_index + i;
+          }
+        }
+      }
+
+      if (pending_props_.empty()) {
+        pending_props_since_ = now_;
+      }
+      // the entries are swapped, not copied, into the held batch, which is
+      // appended in EndBatch.
+      pending_props_bytes_ += size;
+      for (int i = 0; i < m->entries_size(); i++) {
+        pending_props_.Add()->Swap(m->mutable_entries(i));
+      }
+      return OK;
+    }
+    case raftpb::MsgReadIndex: {
+      uint64_t committed = raft_log_->Committed();
+      if (Quorum() > 1) {
+        if (!CommittedEntryInCurrentTerm()) {
+          // reject read only request when this leader has not committed any
+          // log entry at its term.
+          return OK;
+        }
+
+        if (read_only_->LeaseValid(now_)) {
+          SendReadIndexResp(ReadOnly::ReadRequest{committed, std::move(m)});
+        } else {
+          // the batch is sealed and its heartbeat round sent in EndBatch.
+          read_only_->AddRequest(committed, std::move(m));
+        }
+      } else {
+        SendReadIndexResp(ReadOnly::ReadRequest{committed, std::move(m)});
+      }
+      return OK;
+    }
+    default:
+      break;
+  }
+
+  auto iter = prs_.find(m->from());
+  if (prs_.end() == iter) {
+    return OK;
+  }
+  Progress& pr = iter->second;
+  const uint64_t from = m->from();
+
+  switch (m->type()) {
+    case raftpb::MsgAppResp: {
+      std::unique_ptr<const raftpb::Message> resp(std::move(m));
+      if (pr.ProgressAppResp(resp, now_)) {
+        // the commit index and the next MsgApp are worked out once per batch.
+        if (!resp->reject()) {
+          maybe_commit_ = true;
+        }
+        MarkAppend(from, false);
+      }
+
+      if (!resp->reject() && from == lead_transferee_ && pr.Match() == raft_log_->LastIndex()) {
+        SendTimeoutNow(from);
+      }
+      break;
+    }
+    case raftpb::MsgHeartbeatResp: {
+      std::unique_ptr<const raftpb::Message> resp(std::move(m));
+      pr.ProgressHeartbeatResp(resp, now_);
+      if (pr.Match() < raft_log_->LastIndex()) {
+        MarkAppend(from, false);
+      }
+
+      if (resp->context().empty()) {
+        return OK;
+      }
+
+      if (static_cast<int>(read_only_->RecvAck(resp)) < Quorum()) {
+        return OK;
+      }
+
+      std::vector<ReadOnly::ReadRequest> released;
+      read_only_->Advance(resp, &released);
+      for (const auto& rr : released) {
+        SendReadIndexResp(rr);
+      }
+      break;
+    }
+    case raftpb::MsgSnapStatus: {
+      std::unique_ptr<const raftpb::Message> status(std::move(m));
+      pr.ProgressSnapStatus(status);
+      break;
+    }
+    case raftpb::MsgUnreachable: {
+      std::unique_ptr<const raftpb::Message> status(std::move(m));
+      pr.ProgressUnreachable(status);
+      break;
+    }
+    case raftpb::MsgTransferLeader: {
+      if (pr.IsLearner()) {
+        return OK;
+      }
+
+      if (kNone != lead_transferee_) {
+        if (from == lead_transferee_) {
+          return OK;
+        }
+        AbortLeaderTransfer();
+      }
+      if (from == id_) {
+        return OK;
+      }
+
+      // transfer leadership should be finished in one election timeout.
+      election_elapsed_ = 0;
+      lead_transferee_ = from;
+      // the transferee may win before our lease runs out, and keeps doing
+      // so after an abort since MsgTimeoutNow may still be on its way. No
+      // more lease reads this term.
+      lease_revoked_ = true;
+      read_only_->RevokeLease();
+      if (pr.Match() == raft_log_->LastIndex()) {
+        SendTimeoutNow(from);
+      } else {
+        MarkAppend(from, false);
+      }
+      break;
+    }
+    default:
+      break;
+  }
+
+  return OK;
+}
+
+Raft::Error Raft::StepCandidate(std::unique_ptr<raftpb::Message> m) {
+  // only handle vote responses corresponding to our candidacy, a stale
+  // MsgPreVoteResp may arrive after we become a candidate.
+  raftpb::MessageType my_vote_resp_type =
+      StatePreCandidate == state_ ? raftpb::MsgPreVoteResp : raftpb::MsgVoteResp;
+
+  switch (m->type()) {
+    case raftpb::MsgProp:
+      return ErrProposalDropped;
+    case raftpb::MsgApp:
+      BecomeFollower(m->term(), m->from());
+      HandleAppendEntries(std::move(m));
+      return OK;
+    case raftpb::MsgHeartbeat:
+      BecomeFollower(m->term(), m->from());
+      HandleHeartbeat(std::move(m));
+      return OK;
+    case raftpb::MsgSnap:
+      BecomeFollower(m->term(), m->from());
+      HandleSnapshot(std::move(m));
+      return OK;
+    case raftpb::MsgTimeoutNow:
+      return OK;
+    default:
+      break;
+  }
+
+  if (my_vote_resp_type == m->type()) {
+    int granted = Poll(m->from(), m->type(), !m->reject());
+    int quorum = Quorum();
+    if (quorum == granted) {
+      if (StatePreCandidate == state_) {
+        Campaign(kCampaignElection);
+      } else {
+        BecomeLeader();
+      }
+    } else if (quorum == static_cast<int>(votes_.size()) - granted) {
+      // pre-candidates step down to the term they came from.
+      BecomeFollower(term_, kNone);
+    }
+  }
+
+  return OK;
+}
+
+Raft::Error Raft::StepFollower(std::unique_ptr<raftpb::Message> m) {
+  switch (m->type()) {
+    case raftpb::MsgProp:
+      if (kNone == lead_) {
+        return ErrProposalDropped;
+      }
+      m->set_to(lead_);
+      Send(std::move(m));
+      break;
+    case raftpb::MsgApp:
+      election_elapsed_ = 0;
+      lead_ = m->from();
+      HandleAppendEntries(std::move(m));
+      break;
+    case raftpb::MsgHeartbeat:
+      election_elapsed_ = 0;
+      lead_ = m->from();
+      HandleHeartbeat(std::move(m));
+      break;
+    case raftpb::MsgSnap:
+      election_elapsed_ = 0;
+      lead_ = m->from();
+      HandleSnapshot(std::move(m));
+      break;
+    case raftpb::MsgTransferLeader:
+      if (kNone == lead_) {
+        return OK;
+      }
+      m->set_to(lead_);
+      Send(std::move(m));
+      break;
+    case raftpb::MsgTimeoutNow:
+      if (Promotable()) {
+        // leadership transfers never use pre-vote, we know we are not
+        // recovering from a partition so there is no need for the extra round.
+        Campaign(kCampaignTransfer);
+      }
+      break;
+    case raftpb::MsgReadIndex:
+      if (kNone == lead_) {
+        return OK;
+      }
+      m->set_to(lead_);
+      Send(std::move(m));
+      break;
+    case raftpb::MsgReadIndexResp:
+      if (1 != m->entries_size()) {
+        return OK;
+      }
+      // served locally once applied reaches index, see RaftLog::WaitApplied.
+      read_states_.push_back(ReadState{m->index(), m->entries(0).data()});
+      break;
+    default:
+      break;
+  }
+
+  return OK;
+}
+
+void Raft::EndBatch() {
+  if (--batch_depth_ > 0) {
+    return ;
+  }
+
+  if (StateLeader == state_) {
+    if (maybe_commit_ && MaybeCommit()) {
+      // followers learn the new commit index even without new entries.
+      MarkBcastAppend(true);
+    }
+
+    // acks of this batch may have drained the pipeline, so proposals are
+    // looked at after committing.
+    if (!pending_props_.empty() && ShouldFlushProposals()) {
+      FlushProposals();
+      if (MaybeCommit()) {
+        MarkBcastAppend(true);
+      }
+    }
+
+    if (read_only_->HasOpenBatch()) {
+      BcastHeartbeatWithCtx(read_only_->SealBatch(now_));
+    }
+
+    for (const auto& pending : pending_append_) {
+      if (prs_.end() != prs_.find(pending.first)) {
+        SendAppend(pending.first, pending.second);
+      }
+    }
+  }
+
+  maybe_commit_ = false;
+  pending_append_.clear();
+}
+
+void Raft::MarkAppend(uint64_t to, bool send_if_empty) {
+  for (auto& pending : pending_append_) {
+    if (to == pending.first) {
+      pending.second = pending.second || send_if_empty;
+      return ;
+    }
+  }
+
+  pending_append_.emplace_back(to, send_if_empty);
+}
+
+void Raft::MarkBcastAppend(bool send_if_empty) {
+  for (const auto& pr : prs_) {
+    if (id_ != pr.first) {
+      MarkAppend(pr.first, send_if_empty);
+    }
+  }
+}
+
+void Raft::Send(std::unique_ptr<raftpb::Message> m) {
+  m->set_from(id_);
+  if (raftpb::MsgVote == m->type() || raftpb::MsgVoteResp == m->type() ||
+      raftpb::MsgPreVote == m->type() || raftpb::MsgPreVoteResp == m->type()) {
+    if (0 == m->term()) {
+      //Panicf, term should be set when sending a vote message
+    }
+  } else {
+    if (0 != m->term()) {
+      //Panicf, term should not be set when sending other messages
+    }
+    // proposals are forwarded to the leader and treated as local messages.
+    if (raftpb::MsgProp != m->type() && raftpb::MsgReadIndex != m->type()) {
+      m->set_term(term_);
+    }
+  }
+
+  if (raftpb::MsgAppResp == m->type()) {
+    SendAppResp(std::move(m));
+    return ;
+  }
+
+  // a response promises the entries or the vote it acks are durable, so it
+  // waits for the write, everything else may go out while the write runs.
+  if (raftpb::MsgVoteResp == m->type() || raftpb::MsgPreVoteResp == m->type()) {
+    msgs_after_append_.push_back(std::move(m));
+  } else {
+    msgs_.push_back(std::move(m));
+  }
+}
+
+void Raft::SendAppResp(std::unique_ptr<raftpb::Message> m) {
+  // a reject promises nothing about the disk and lets the leader back off
+  // sooner, so it goes out right away.
+  if (m->reject()) {
+    msgs_.push_back(std::move(m));
+    return ;
+  }
+
+  // accepts of one Ready all become durable together, only the highest one
+  // is worth sending.
+  for (auto& pending : msgs_after_append_) {
+    if (raftpb::MsgAppResp == pending->type() && !pending->reject() &&
+        pending->to() == m->to() && pending->term() == m->term()) {
+      if (m->index() > pending->index()) {
+        pending->set_index(m->index());
+      }
+      return ;
+    }
+  }
+
+  msgs_after_append_.push_back(std::move(m));
+}
+
+bool Raft::SendAppend(uint64_t to, bool send_if_empty) {
+  Progress& pr = prs_.at(to);
+  if (pr.IsPaused()) {
+    return false;
+  }
+
+  std::unique_ptr<raftpb::Message> m(new raftpb::Message);
+  m->set_to(to);
+
+  uint64_t term = 0;
+  auto error_term = raft_log_->Term(pr.Next() - 1, &term);
+  auto error_entries = raft_log_->GetEntries(pr.Next(), max_size_per_msg_, m->mutable_entries());
+  if (0 == m->entries_size() && !send_if_empty) {
+    return false;
+  }
+
+  if (Storage::OK != error_term || Storage::OK != error_entries) {
+    // the entries are compacted away, send a snapshot instead.
+    uint64_t window = election_timeout_ * tick_interval_;
+    if (!pr.RecentActive(now_ > window ? now_ - window : 0)) {
+      return false;
+    }
+
+    m->Clear();
+    m->set_to(to);
+    m->set_type(raftpb::MsgSnap);
+    auto error = raft_log_->Snapshot(m->mutable_snapshot());
+    if (Storage::ErrSnapshotTemporarilyUnavailable == error) {
+      return false;
+    } else if (Storage::OK != error) {
+      //Panicf
+    }
+    if (0 == m->snapshot().metadata().index()) {
+      //Panicf, need non-empty snapshot
+    }
+
+    pr.BecomeSnapshot(m->snapshot().metadata().index());
+  } else {
+    m->set_type(raftpb::MsgApp);
+    m->set_index(pr.Next() - 1);
+    m->set_logterm(term);
+    m->set_commit(raft_log_->Committed());
+    if (m->entries_size() > 0) {
+      pr.SentAppend(m->entries(m->entries_size() - 1).index());
+    }
+  }
+
+  Send(std::move(m));
+  return true;
+}
+
+void Raft::SendHeartbeat(uint64_t to, const std::string& ctx) {
+  // the follower may not have every committed entry yet, attach only what
+  // it is known to match.
+  uint64_t commit = std::min(prs_.at(to).Match(), raft_log_->Committed());
+
+  std::unique_ptr<raftpb::Message> m(new raftpb::Message);
+  m->set_to(to);
+  m->set_type(raftpb::MsgHeartbeat);
+  m->set_commit(commit);
+  m->set_context(ctx);
+  Send(std::move(m));
+}
+
+void Raft::BcastHeartbeat() {
+  // in lease mode every heartbeat is a round of its own so that it renews
+  // the lease, otherwise heartbeats carry the last pending round.
+  if (read_only_->Leasing()) {
+    BcastHeartbeatWithCtx(read_only_->SealBatch(now_));
+  } else {
+    BcastHeartbeatWithCtx(read_only_->LastPendingRequestCtx());
+  }
+}
+
+void Raft::BcastHeartbeatWithCtx(const std::string& ctx) {
+  for (const auto& pr : prs_) {
+    if (id_ != pr.first) {
+      SendHeartbeat(pr.first, ctx);
+    }
+  }
+}
+
+void Raft::SendReadIndexResp(const ReadOnly::ReadRequest& rr) {
+  const raftpb::Message& request = *rr.request;
+  if (kNone == request.from() || id_ == request.from()) {
+    read_states_.push_back(ReadState{rr.index, request.entries(0).data()});
+    return ;
+  }
+
+  std::unique_ptr<raftpb::Message> m(new raftpb::Message);
+  m->set_to(request.from());
+  m->set_type(raftpb::MsgReadIndexResp);
+  m->set_index(rr.index);
+  *m->mutable_entries() = request.entries();
+  Send(std::move(m));
+}
+
+bool Raft::MaybeCommit() {
+  match_scratch_.clear();
+  for (const auto& pr : prs_) {
+    if (!pr.second.IsLearner()) {
+      match_scratch_.push_back(pr.second.Match());
+    }
+  }
+  if (match_scratch_.empty()) {
+    return false;
+  }
+
+  size_t quorum = Quorum();
+  std::nth_element(match_scratch_.begin(), match_scratch_.begin() + quorum - 1,
+                   match_scratch_.end(), std::greater<uint64_t>());
+  if (!raft_log_->MaybeCommit(match_scratch_[quorum - 1], term_)) {
+    return false;
+  }
+
+  ReduceUncommittedSize();
+  return true;
+}
+
+void Raft::AppendEntry(google::protobuf::RepeatedPtrField<raftpb::Entry>* entries) {
+  uint64_t last_index = raft_log_->LastIndex();
+  for (int i = 0; i < entries->size(); i++) {
+    entries->Mutable(i)->set_term(term_);
+    entries->Mutable(i)->set_index(last_index + 1 + i);
+  }
+  raft_log_->Append(EntrySlice(*entries, 0, entries->size()));
+
+  // the entries go out to followers right away, but the leader's own match
+  // only moves once they are on its disk, see StableTo.
+  maybe_commit_ = true;
+}
+
+bool Raft::HasUncommittedRoom(uint64_t size) const {
+  uint64_t uncommitted = uncommitted_size_ + pending_props_bytes_;
+  // a proposal is always let through when nothing is uncommitted, so a single
+  // entry larger than the limit can still make progress.
+  return 0 == max_uncommitted_size_ || 0 == uncommitted ||
+         uncommitted + size <= max_uncommitted_size_;
+}
+
+void Raft::ReduceUncommittedSize() {
+  uint64_t committed = raft_log_->Committed();
+  while (!uncommitted_.empty() && uncommitted_.front().first <= committed) {
+    uncommitted_size_ -= uncommitted_.front().second;
+    uncommitted_.pop_front();
+  }
+}
+
+bool Raft::ShouldFlushProposals() const {
+  // nothing in flight, waiting would only add latency.
+  if (raft_log_->Committed() == raft_log_->LastIndex()) {
+    return true;
+  }
+
+  // a limit of 0 bounds nothing, with neither set proposals are not held.
+  if (0 == max_proposal_batch_bytes_ && 0 == proposal_batch_window_) {
+    return true;
+  }
+  return (0 != max_proposal_batch_bytes_ && pending_props_bytes_ >= max_proposal_batch_bytes_) ||
+         (0 != proposal_batch_window_ && now_ - pending_props_since_ >= proposal_batch_window_);
+}
+
+void Raft::FlushProposals() {
+  // one TruncateAndAppend for the whole batch, and one MsgApp per follower
+  // since the sends are deferred to the end of the batch as well.
+  AppendEntry(&pending_props_);
+  MarkBcastAppend(false);
+
+  if (pending_props_bytes_ > 0) {
+    uncommitted_size_ += pending_props_bytes_;
+    uncommitted_.emplace_back(raft_log_->LastIndex(), pending_props_bytes_);
+  }
+
+  pending_props_.Clear();
+  pending_props_bytes_ = 0;
+}
+
+void Raft::Reset(uint64_t term) {
+  if (term_ != term) {
+    term_ = term;
+    vote_ = kNone;
+  }
+  lead_ = kNone;
+
+  election_elapsed_ = 0;
+  heartbeat_elapsed_ = 0;
+  ResetRandomizedElectionTimeout();
+
+  AbortLeaderTransfer();
+  lease_revoked_ = false;
+
+  votes_.clear();
+  uint64_t last_index = raft_log_->LastIndex();
+  std::map<uint64_t, Progress> prs;
+  for (const auto& pr : prs_) {
+    auto iter = prs.emplace(pr.first, Progress(0, last_index + 1, max_inflight_,
+                                               pr.second.IsLearner())).first;
+    if (id_ == pr.first) {
+      iter->second.MaybeUpdate(raft_log_->StableIndex());
+    }
+  }
+  prs_.swap(prs);
+
+  pending_conf_index_ = 0;
+  maybe_commit_ = false;
+  pending_append_.clear();
+  ResetReadOnly();
+
+  // held proposals are dropped like any other uncommitted proposal of a
+  // leader that steps down.
+  pending_props_.Clear();
+  pending_props_bytes_ = 0;
+  uncommitted_size_ = 0;
+  uncommitted_.clear();
+}
+
+void Raft::TickElection() {
+  election_elapsed_++;
+
+  if (Promotable() && PastElectionTimeout()) {
+    election_elapsed_ = 0;
+    std::unique_ptr<raftpb::Message> m(new raftpb::Message);
+    m->set_from(id_);
+    m->set_type(raftpb::MsgHup);
+    StepMessage(std::move(m));
+  }
+}
+
+void Raft::TickHeartbeat() {
+  heartbeat_elapsed_++;
+  election_elapsed_++;
+
+  if (election_elapsed_ >= election_timeout_) {
+    election_elapsed_ = 0;
+    if (check_quorum_) {
+      std::unique_ptr<raftpb::Message> m(new raftpb::Message);
+      m->set_from(id_);
+      m->set_type(raftpb::MsgCheckQuorum);
+      StepMessage(std::move(m));
+    }
+    // abort leadership transfer if it could not finish in one election timeout.
+    if (StateLeader == state_ && kNone != lead_transferee_) {
+      AbortLeaderTransfer();
+    }
+  }
+
+  if (StateLeader != state_) {
+    return ;
+  }
+
+  if (heartbeat_elapsed_ >= heartbeat_timeout_) {
+    heartbeat_elapsed_ = 0;
+    std::unique_ptr<raftpb::Message> m(new raftpb::Message);
+    m->set_from(id_);
+    m->set_type(raftpb::MsgBeat);
+    StepMessage(std::move(m));
+  }
+}
+
+void Raft::ResetRandomizedElectionTimeout() {
+  std::uniform_int_distribution<int> distribution(0, election_timeout_ - 1);
+  randomized_election_timeout_ = election_timeout_ + distribution(random_);
+}
+
+bool Raft::Promotable() const {
+  auto iter = prs_.find(id_);
+  return prs_.end() != iter && !iter->second.IsLearner();
+}
+
+bool Raft::CheckQuorumActive() const {
+  uint64_t window = election_timeout_ * tick_interval_;
+  uint64_t since = now_ > window ? now_ - window : 0;
+
+  int active = 0;
+  for (const auto& pr : prs_) {
+    if (pr.second.IsLearner()) {
+      continue;
+    }
+    if (id_ == pr.first || pr.second.RecentActive(since)) {
+      active++;
+    }
+  }
+
+  return active >= Quorum();
+}
+
+bool Raft::CommittedEntryInCurrentTerm() {
+  uint64_t term = 0;
+  auto error = raft_log_->Term(raft_log_->Committed(), &term);
+  return RaftLog::ZeroTermOnErrCompacted(term, error) == term_;
+}
+
+void Raft::Campaign(const std::string& type) {
+  uint64_t term = 0;
+  raftpb::MessageType vote_msg;
+  if (kCampaignPreElection == type) {
+    BecomePreCandidate();
+    vote_msg = raftpb::MsgPreVote;
+    // PreVote RPCs are sent for the next term before we've incremented term_.
+    term = term_ + 1;
+  } else {
+    BecomeCandidate();
+    vote_msg = raftpb::MsgVote;
+    term = term_;
+  }
+
+  if (Quorum() == Poll(id_, VoteRespMsgType(vote_msg), true)) {
+    // won the election after voting for ourselves, a single node cluster.
+    if (kCampaignPreElection == type) {
+      Campaign(kCampaignElection);
+    } else {
+      BecomeLeader();
+    }
+    return ;
+  }
+
+  for (const auto& pr : prs_) {
+    if (id_ == pr.first || pr.second.IsLearner()) {
+      continue;
+    }
+
+    std::unique_ptr<raftpb::Message> m(new raftpb::Message);
+    m->set_to(pr.first);
+    m->set_term(term);
+    m->set_type(vote_msg);
+    m->set_index(raft_log_->LastIndex());
+    m->set_logterm(raft_log_->LastTerm());
+    if (kCampaignTransfer == type) {
+      m->set_context(type);
+    }
+    Send(std::move(m));
+  }
+}
+
+int Raft::Poll(uint64_t id, raftpb::MessageType type, bool v) {
+  (void)type;
+
+  if (votes_.end() == votes_.find(id)) {
+    votes_[id] = v;
+  }
+
+  int granted = 0;
+  for (const auto& vote : votes_) {
+    if (vote.second) {
+      granted++;
+    }
+  }
+  return granted;
+}
+
+int Raft::Quorum() const {
+  int voters = 0;
+  for (const auto& pr : prs_) {
+    if (!pr.second.IsLearner()) {
+      voters++;
+    }
+  }
+  return voters / 2 + 1;
+}
+
+void Raft::HandleAppendEntries(std::unique_ptr<raftpb::Message> m) {
+  std::unique_ptr<raftpb::Message> resp(new raftpb::Message);
+  resp->set_to(m->from());
+  resp->set_type(raftpb::MsgAppResp);
+
+  if (m->index() < raft_log_->Committed()) {
+    resp->set_index(raft_log_->Committed());
+    Send(std::move(resp));
+    return ;
+  }
+
+  uint64_t last_new_index = 0;
+  if (raft_log_->MaybeAppend(m->index(), m->logterm(), m->commit(),
+                             EntrySlice(m->entries(), 0, m->entries_size()),
+                             &last_new_index)) {
+    resp->set_index(last_new_index);
+  } else {
+    resp->set_index(m->index());
+    resp->set_reject(true);
+    resp->set_rejecthint(raft_log_->LastIndex());
+  }
+  Send(std::move(resp));
+}
+
+void Raft::HandleHeartbeat(std::unique_ptr<raftpb::Message> m) {
+  raft_log_->CommitTo(m->commit());
+
+  std::unique_ptr<raftpb::Message> resp(new raftpb::Message);
+  resp->set_to(m->from());
+  resp->set_type(raftpb::MsgHeartbeatResp);
+  resp->set_context(m->context());
+  Send(std::move(resp));
+}
+
+void Raft::HandleSnapshot(std::unique_ptr<raftpb::Message> m) {
+  std::unique_ptr<raftpb::Message> resp(new raftpb::Message);
+  resp->set_to(m->from());
+  resp->set_type(raftpb::MsgAppResp);
+
+  if (Restore(m->snapshot())) {
+    resp->set_index(raft_log_->LastIndex());
+  } else {
+    resp->set_index(raft_log_->Committed());
+  }
+  Send(std::move(resp));
+}
+
+bool Raft::Restore(const raftpb::Snapshot& snapshot) {
+  const raftpb::SnapshotMetadata& metadata = snapshot.metadata();
+  if (metadata.index() <= raft_log_->Committed()) {
+    return false;
+  }
+
+  if (raft_log_->MatchTerm(metadata.index(), metadata.term())) {
+    // fast-forward the commit index, the log already holds the snapshot.
+    raft_log_->CommitTo(metadata.index());
+    return false;
+  }
+
+  // the learner flag of this node can not be changed by a snapshot.
+  if (!is_learner_) {
+    for (uint64_t learner : metadata.confstate().learners()) {
+      if (id_ == learner) {
+        //Errorf, can't become learner when restores snapshot
+        return false;
+      }
+    }
+  }
+
+  raft_log_->Restore(snapshot);
+  prs_.clear();
+  RestoreNode(std::vector<uint64_t>(metadata.confstate().nodes().begin(),
+                                    metadata.confstate().nodes().end()), false);
+  RestoreNode(std::vector<uint64_t>(metadata.confstate().learners().begin(),
+                                    metadata.confstate().learners().end()), true);
+  ResetReadOnly();
+  return true;
+}
+
+void Raft::RestoreNode(const std::vector<uint64_t>& nodes, bool is_learner) {
+  for (uint64_t node : nodes) {
+    uint64_t match = 0;
+    uint64_t next = raft_log_->LastIndex() + 1;
+    if (id_ == node) {
+      match = next - 1;
+      is_learner_ = is_learner;
+    }
+    SetProgress(node, match, next, is_learner);
+  }
+}
+
+void Raft::LoadState(const raftpb::HardState& state) {
+  if (state.commit() < raft_log_->Committed() || state.commit() > raft_log_->LastIndex()) {
+    //Panicf, state.commit is out of range
+  }
+
+  raft_log_->CommitTo(state.commit());
+  term_ = state.term();
+  vote_ = state.vote();
+}
+
+void Raft::AddNodeOrLearnerNode(uint64_t id, bool is_learner) {
+  auto iter = prs_.find(id);
+  if (prs_.end() == iter) {
+    SetProgress(id, 0, raft_log_->LastIndex() + 1, is_learner);
+    iter = prs_.find(id);
+  } else {
+    if (is_learner && !iter->second.IsLearner()) {
+      //Infof, ignored addLearner because node is already a voter
+      return ;
+    }
+    if (is_learner == iter->second.IsLearner()) {
+      // ignore any redundant addNode calls, which can happen if the
+      // initial bootstrapping entries are applied twice.
+      return ;
+    }
+
+    // promote a learner to a voter.
+    iter->second.SetLearner(false);
+    ResetReadOnly();
+  }
+
+  if (id_ == id) {
+    is_learner_ = is_learner;
+  }
+
+  // a newly added node counts as active, or CheckQuorum may step us down
+  // before it had a chance to communicate with us.
+  iter->second.SetRecentActiveTime(myutil::MonotonicMicros());
+}
+
+void Raft::SetProgress(uint64_t id, uint64_t match, uint64_t next, bool is_learner) {
+  prs_.erase(id);
+  Progress pr(match, next, max_inflight_, is_learner);
+  prs_.emplace(id, std::move(pr));
+
+  if (nullptr != read_only_.get() && !is_learner) {
+    read_only_->SetVoters(Voters());
+  }
+}
+
+void Raft::DelProgress(uint64_t id) {
+  prs_.erase(id);
+
+  if (nullptr != read_only_.get()) {
+    read_only_->SetVoters(Voters());
+  }
+}
+
+std::vector<uint64_t> Raft::Voters() const {
+  std::vector<uint64_t> voters;
+  for (const auto& pr : prs_) {
+    if (id_ != pr.first && !pr.second.IsLearner()) {
+      voters.push_back(pr.first);
+    }
+  }
+  return voters;
+}
+
+void Raft::ResetReadOnly() {
+  // a follower's first tick may come right after the heartbeat it resets its
+  // election timer on, so it can vote again election_timeout_ - 1 full ticks
+  // after that.
+  read_only_.reset(new ReadOnly(kReadOnlyOption, id_,
+                                (election_timeout_ - 1) * tick_interval_, max_clock_drift_));
+  read_only_->SetVoters(Voters());
+  if (lease_revoked_) {
+    read_only_->RevokeLease();
+  }
+}
+
+void Raft::SendTimeoutNow(uint64_t to) {
+  std::unique_ptr<raftpb::Message> m(new raftpb::Message);
+  m->set_to(to);
+  m->set_type(raftpb::MsgTimeoutNow);
+  Send(std::move(m));
+}
+
+raftpb::MessageType Raft::VoteRespMsgType(raftpb::MessageType type) {
+  switch (type) {
+    case raftpb::MsgVote:
+      return raftpb::MsgVoteResp;
+    case raftpb::MsgPreVote:
+      return raftpb::MsgPreVoteResp;
+    default:
+      //Panicf, not a vote message
+      return raftpb::MsgVoteResp;
+  }
+}
+
+} // namespace myraft
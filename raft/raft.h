@@ -0,0 +1,293 @@
+#ifndef MYRAFT_RAFT_H_
+#define MYRAFT_RAFT_H_
+
+#include <stdint.h>
+
+#include <deque>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "progress.h"
+#include "raftlog.h"
+#include "read_only.h"
+#include "storage.h"
+#include "raftpb/raft.pb.h"
+
+namespace myraft {
+
+static const uint64_t kNone = 0;
+
+enum StateType {
+  StateFollower,
+  StateCandidate,
+  StateLeader,
+  StatePreCandidate,
+}; // enum StateType
+
+struct Config {
+  uint64_t id;
+  // only used to start a brand new cluster, otherwise peers come from storage.
+  std::vector<uint64_t> peers;
+  std::vector<uint64_t> learners;
+
+  int election_tick;
+  int heartbeat_tick;
+  // microseconds a tick lasts, lets lease reads turn ticks into time.
+  uint64_t tick_interval;
+  uint64_t max_clock_drift;
+
+  std::shared_ptr<Storage> storage;
+  uint64_t applied;
+
+  // bytes of entries in one MsgApp, as measured by ByteSizeLong. A MsgApp
+  // carries at least one entry whatever its size, so 0 sends them one at a
+  // time. Transports refuse messages past their frame limit (kMaxFrameSize
+  // for TcpTransport), keep it well below that.
+  uint64_t max_size_per_msg;
+  // MsgApps in flight to one follower, 0 is taken as 1.
+  uint64_t max_inflight_msgs;
+
+  // while earlier entries are still uncommitted, the leader holds proposals
+  // until they add up to max_proposal_batch_bytes or the oldest one waited
+  // proposal_batch_window microseconds. An idle leader appends right away.
+  // 0 leaves that limit out, with both 0 proposals are never held. Held
+  // proposals also go out once everything before them is committed.
+  uint64_t max_proposal_batch_bytes;
+  uint64_t proposal_batch_window;
+
+  // bytes of proposal data the leader accepts beyond its commit index before
+  // refusing proposals with ErrProposalTooLarge. 0 means no limit.
+  uint64_t max_uncommitted_size;
+
+  bool check_quorum;
+  bool pre_vote;
+  // ReadOnlyLeaseBased requires check_quorum, without it followers do not
+  // honor the lease and reads fall back to ReadOnlySafe.
+  ReadOnly::ReadOnlyOption read_only_option;
+}; // struct Config
+
+struct SoftState {
+  uint64_t  lead;
+  StateType raft_state;
+}; // struct SoftState
+
+// ReadState is handed back to the application for every read index request,
+// the read can be served once the applied index reaches index.
+struct ReadState {
+  uint64_t    index;
+  std::string request_ctx;
+}; // struct ReadState
+
+// Raft is the consensus state machine. Messages are stepped in batches: the
+// per-message work only updates Progress and the log, while committing and
+// sending MsgApp/heartbeat rounds are deferred to the end of the batch, so a
+// batch of N acks costs one commit computation and at most one MsgApp per
+// follower.
+class Raft {
+ public:
+  enum Error {
+    OK,
+    ErrProposalDropped,
+    ErrStepLocalMsg,
+    ErrStepPeerNotFound,
+    ErrProposalTooLarge,
+  }; // enum Error
+
+  static std::string ErrorString(Error error) {
+    static const char* kErrorStrings[] = {
+      "OK",
+      "raft proposal dropped",
+      "raft: cannot step raft local message",
+      "raft: cannot step as peer not found",
+      "raft: too many uncommitted bytes",
+    };
+
+    return kErrorStrings[error];
+  }
+
+  using Messages = std::vector<std::unique_ptr<raftpb::Message>>;
+
+ public:
+  Raft(const Config& config);
+  ~Raft() = default;
+
+  Raft(const Raft&)            = delete;
+  Raft& operator=(const Raft&) = delete;
+  Raft(Raft&&)                 = delete;
+  Raft& operator=(Raft&&)      = delete;
+
+  Error Step(std::unique_ptr<raftpb::Message> m);
+  // steps every message of msgs and then does the deferred work once, msgs is
+  // left empty. Returns the number of messages that failed to step.
+  size_t StepBatch(Messages* msgs);
+  void Tick();
+
+  void BecomeFollower(uint64_t term, uint64_t lead);
+  void BecomeCandidate();
+  void BecomePreCandidate();
+  void BecomeLeader();
+
+  // true iff this leader has replicated and committed everything on every
+  // peer and has no proposal, read or leader transfer in flight.
+  bool CanQuiesce() const;
+
+  void AddNode(uint64_t id);
+  void AddLearner(uint64_t id);
+  void RemoveNode(uint64_t id);
+
+  SoftState       GetSoftState() const { return SoftState{lead_, state_}; }
+  raftpb::HardState GetHardState() const;
+  uint64_t        Id()    const { return id_; }
+  uint64_t        Term()  const { return term_; }
+  uint64_t        Lead()  const { return lead_; }
+  StateType       State() const { return state_; }
+  RaftLog*        Log()         { return raft_log_.get(); }
+  const std::map<uint64_t, Progress>& Progresses() const { return prs_; }
+
+  // entries up to index are on disk. A leader counts its own vote toward the
+  // commit quorum only from here on.
+  void StableTo(uint64_t index, uint64_t term);
+
+  // outgoing messages and read states accumulated since the last call.
+  // msgs_after_append must wait until the pending entries and HardState are
+  // persisted, msgs can be sent concurrently with the write.
+  void TakeMessages(Messages* msgs, Messages* msgs_after_append);
+  void TakeReadStates(std::vector<ReadState>* read_states);
+  bool HasMessages()   const { return !msgs_.empty() || !msgs_after_append_.empty(); }
+  bool HasReadStates() const { return !read_states_.empty(); }
+
+  std::string String() const;
+
+ private:
+  using StepFunc = Error (Raft::*)(std::unique_ptr<raftpb::Message>);
+
+  Error StepMessage(std::unique_ptr<raftpb::Message> m);
+  Error StepLeader(std::unique_ptr<raftpb::Message> m);
+  Error StepCandidate(std::unique_ptr<raftpb::Message> m);
+  Error StepFollower(std::unique_ptr<raftpb::Message> m);
+
+  // deferred work, see the class comment.
+  void BeginBatch() { batch_depth_++; }
+  void EndBatch();
+  void MarkAppend(uint64_t to, bool send_if_empty);
+  void MarkBcastAppend(bool send_if_empty);
+
+  void Send(std::unique_ptr<raftpb::Message> m);
+  void SendAppResp(std::unique_ptr<raftpb::Message> m);
+  bool SendAppend(uint64_t to, bool send_if_empty);
+  void SendHeartbeat(uint64_t to, const std::string& ctx);
+  void BcastHeartbeat();
+  void BcastHeartbeatWithCtx(const std::string& ctx);
+  void SendReadIndexResp(const ReadOnly::ReadRequest& rr);
+
+  bool MaybeCommit();
+  void AppendEntry(google::protobuf::RepeatedPtrField<raftpb::Entry>* entries);
+  bool HasUncommittedRoom(uint64_t size) const;
+  void ReduceUncommittedSize();
+  bool ShouldFlushProposals() const;
+  void FlushProposals();
+
+  void Reset(uint64_t term);
+  void TickElection();
+  void TickHeartbeat();
+  bool PastElectionTimeout() const { return election_elapsed_ >= randomized_election_timeout_; }
+  void ResetRandomizedElectionTimeout();
+  bool Promotable() const;
+  bool CheckQuorumActive() const;
+  bool CommittedEntryInCurrentTerm();
+
+  void Campaign(const std::string& type);
+  int  Poll(uint64_t id, raftpb::MessageType type, bool v);
+  int  Quorum() const;
+
+  void HandleAppendEntries(std::unique_ptr<raftpb::Message> m);
+  void HandleHeartbeat(std::unique_ptr<raftpb::Message> m);
+  void HandleSnapshot(std::unique_ptr<raftpb::Message> m);
+  bool Restore(const raftpb::Snapshot& snapshot);
+  void RestoreNode(const std::vector<uint64_t>& nodes, bool is_learner);
+  void LoadState(const raftpb::HardState& state);
+  void AddNodeOrLearnerNode(uint64_t id, bool is_learner);
+
+  void SetProgress(uint64_t id, uint64_t match, uint64_t next, bool is_learner);
+  void DelProgress(uint64_t id);
+  std::vector<uint64_t> Voters() const;
+  void ResetReadOnly();
+
+  void SendTimeoutNow(uint64_t to);
+  void AbortLeaderTransfer() { lead_transferee_ = kNone; }
+
+  static raftpb::MessageType VoteRespMsgType(raftpb::MessageType type);
+
+ private:
+  const uint64_t id_;
+  uint64_t term_;
+  uint64_t vote_;
+
+  std::vector<ReadState> read_states_;
+
+  std::unique_ptr<RaftLog> raft_log_;
+
+  const uint64_t max_size_per_msg_;
+  const uint64_t max_inflight_;
+  std::map<uint64_t, Progress> prs_;
+  bool is_learner_;
+
+  StateType state_;
+  std::map<uint64_t, bool> votes_;
+  Messages msgs_;
+  Messages msgs_after_append_;
+
+  uint64_t lead_;
+  uint64_t lead_transferee_;
+  // a leader transfer was started this term, see ReadOnly::RevokeLease.
+  bool     lease_revoked_;
+  uint64_t pending_conf_index_;
+
+  const ReadOnly::ReadOnlyOption kReadOnlyOption;
+  std::unique_ptr<ReadOnly> read_only_;
+
+  int election_elapsed_;
+  int heartbeat_elapsed_;
+
+  const bool check_quorum_;
+  const bool pre_vote_;
+
+  const int heartbeat_timeout_;
+  const int election_timeout_;
+  const uint64_t tick_interval_;
+  const uint64_t max_clock_drift_;
+  int randomized_election_timeout_;
+  std::default_random_engine random_;
+
+  StepFunc step_;
+  bool     tick_leader_;
+
+  // state of the batch being stepped.
+  int      batch_depth_;
+  uint64_t now_;
+  bool     maybe_commit_;
+  // followers owed a SendAppend, and whether to send it even without entries.
+  std::vector<std::pair<uint64_t, bool>> pending_append_;
+  std::vector<uint64_t>    match_scratch_;
+
+  // proposals held by the leader, appended together by FlushProposals.
+  const uint64_t max_proposal_batch_bytes_;
+  const uint64_t proposal_batch_window_;
+  google::protobuf::RepeatedPtrField<raftpb::Entry> pending_props_;
+  uint64_t pending_props_bytes_;
+  uint64_t pending_props_since_;
+
+  // appended but uncommitted proposal bytes, one (last index, bytes) per
+  // flushed batch so a commit releases whole batches at once.
+  const uint64_t max_uncommitted_size_;
+  uint64_t uncommitted_size_;
+  std::deque<std::pair<uint64_t, uint64_t>> uncommitted_;
+}; // class Raft
+
+} // namespace myraft
+
+#endif // MYRAFT_RAFT_H_
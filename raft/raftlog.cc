@@ -2,6 +2,8 @@
 
 #include <stdio.h>
 
+#include <utility>
+
 #include <util/make_unique.h>
 
 namespace myraft {
@@ -11,7 +13,8 @@ RaftLog::RaftLog(const std::shared_ptr<Storage>& storage,
     : storage_(storage),
       unstable_(last_index + 1),
       committed_(first_index - 1),
-      applied_(first_index - 1) {}
+      applied_(first_index - 1),
+      apply_wait_(first_index - 1) {}
 
 bool RaftLog::MaybeAppend(uint64_t index, uint64_t term, uint64_t committed,
                           const EntrySlice& entries, uint64_t* new_last_index) {
@@ -70,6 +73,11 @@ void RaftLog::ApplyTo(uint64_t applied) {
     //Panicf
   }
   applied_ = applied;
+  apply_wait_.Trigger(applied_);
+}
+
+void RaftLog::WaitApplied(uint64_t index, ApplyWait::Callback callback) {
+  apply_wait_.Wait(index, std::move(callback));
 }
 
 void RaftLog::StableTo(uint64_t index, uint64_t term) {
@@ -103,14 +111,14 @@ Storage::Error RaftLog::Snapshot(raftpb::Snapshot* snapshot) const {
   return storage_->Snapshot(snapshot);
 }
 
-Storage::Error RaftLog::GetEntries(uint64_t index, uint64_t max, Entries* entries) {
+Storage::Error RaftLog::GetEntries(uint64_t index, uint64_t max_size, Entries* entries) {
   uint64_t last_index = LastIndex();
   if (index > last_index) {
     entries->Clear();
     return Storage::OK;
   }
 
-  return Slice(index, std::min(index + max, last_index + 1), entries);
+  return Slice(index, last_index + 1, max_size, entries);
 }
 
 void RaftLog::UnstableEntries(Entries* entries) {
@@ -127,7 +135,7 @@ void RaftLog::UnstableEntries(Entries* entries) {
 void RaftLog::NextEntries(Entries* entries) {
   uint64_t offset = std::max(applied_ + 1, FirstIndex());
   if (committed_ + 1 > offset) {
-    auto error = Slice(offset, committed_ + 1, entries);
+    auto error = Slice(offset, committed_ + 1, kNoLimit, entries);
     if (Storage::OK != error) {
       //Panicf
     }
@@ -248,7 +256,8 @@ uint64_t RaftLog::FindConflict(const EntrySlice& entries) {
   return 0;
 }
 
-Storage::Error RaftLog::Slice(uint64_t low, uint64_t high, Entries* entries) {
+Storage::Error RaftLog::Slice(uint64_t low, uint64_t high, uint64_t max_size,
+                              Entries* entries) {
   entries->Clear();
 
   auto error = MustCheckOutOfBounds(low, high);
@@ -261,7 +270,7 @@ Storage::Error RaftLog::Slice(uint64_t low, uint64_t high, Entries* entries) {
   }
 
   if (low < unstable_.First()) {
-    auto error = storage_->GetEntries(low, std::min(high, unstable_.First()), entries);
+    auto error = storage_->GetEntries(low, std::min(high, unstable_.First()), max_size, entries);
     if (Storage::ErrCompacted == error) {
       return error;
     } else if (Storage::ErrUnavailable == error) {
@@ -270,13 +279,22 @@ Storage::Error RaftLog::Slice(uint64_t low, uint64_t high, Entries* entries) {
       //Panicf
     }
 
+    // storage stopped short, at max_size or otherwise.
     if (static_cast<uint64_t>(entries->size()) < std::min(high, unstable_.First()) - low) {
       return Storage::OK;
     }
   }
 
   if (high > unstable_.First()) {
-    unstable_.Slice(std::max(low, unstable_.First()), high, entries);
+    uint64_t size = 0;
+    for (const auto& entry : *entries) {
+      size += entry.ByteSizeLong();
+    }
+    if (size >= max_size && !entries->empty()) {
+      return Storage::OK;
+    }
+    unstable_.Slice(std::max(low, unstable_.First()), high, entries,
+                    entries->empty() ? max_size : max_size - size);
   }
 
   return Storage::OK;
@@ -5,6 +5,7 @@
 
 #include <memory>
 
+#include "apply_wait.h"
 #include "storage.h"
 #include "entry_slice.h"
 #include "unstable.h"
@@ -27,11 +28,14 @@ class RaftLog {
 
   bool MaybeAppend(uint64_t index, uint64_t term, uint64_t committed,
                    const EntrySlice& entries, uint64_t* new_last_index);
+  uint64_t Append(const EntrySlice& entries);
   void Restore(const raftpb::Snapshot& snapshot);
 
   bool MaybeCommit(uint64_t index, uint64_t term);
   void CommitTo(uint64_t committed);
   void ApplyTo(uint64_t applied);
+  // callback runs once applied index reaches index, see ApplyWait.
+  void WaitApplied(uint64_t index, ApplyWait::Callback callback);
   void StableTo(uint64_t index, uint64_t term);
   void StableSnapTo(uint64_t index);
 
@@ -39,13 +43,22 @@ class RaftLog {
   bool MatchTerm(uint64_t index, uint64_t term);
 
   Storage::Error Snapshot(raftpb::Snapshot* snapshot) const;
-  Storage::Error GetEntries(uint64_t index, uint64_t max, Entries* entries);
+  // entries from index on, at most max_size bytes of them but at least one.
+  Storage::Error GetEntries(uint64_t index, uint64_t max_size, Entries* entries);
+  // the entries in [low, high), limited as with GetEntries.
+  Storage::Error Slice(uint64_t low, uint64_t high, uint64_t max_size, Entries* entries);
   void UnstableEntries(Entries* entries);
+  bool HasUnstableEntries() const { return 0 != unstable_.Size(); }
+  bool UnstableSnapshot(raftpb::Snapshot* snapshot) const { return unstable_.Snapshot(snapshot); }
   void NextEntries(Entries* entries);
   bool HasNextEntries() const;
 
+  uint64_t Committed() const { return committed_; }
+  uint64_t Applied()   const { return applied_; }
   uint64_t FirstIndex() const;
   uint64_t LastIndex() const;
+  // last index known to be persisted.
+  uint64_t StableIndex() const { return unstable_.First() - 1; }
   uint64_t LastTerm();
   Storage::Error Term(uint64_t index, uint64_t* result);
 
@@ -54,10 +67,8 @@ class RaftLog {
   static uint64_t ZeroTermOnErrCompacted(uint64_t term, Storage::Error error);
 
  private:
-  uint64_t Append(const EntrySlice& entries);
   uint64_t FindConflict(const EntrySlice& entries);
 
-  Storage::Error Slice(uint64_t low, uint64_t high, Entries* entries);
   Storage::Error MustCheckOutOfBounds(uint64_t low, uint64_t high) const;
 
  private:
@@ -65,6 +76,7 @@ class RaftLog {
   Unstable unstable_;
   uint64_t committed_;
   uint64_t applied_;
+  ApplyWait apply_wait_;
 }; // class RaftLog
 
 std::unique_ptr<RaftLog> NewRaftLog(const std::shared_ptr<Storage>& storage);
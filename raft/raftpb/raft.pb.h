@@ -1,119 +1,118 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: raft.proto
 
-#ifndef PROTOBUF_raft_2eproto__INCLUDED
-#define PROTOBUF_raft_2eproto__INCLUDED
+#ifndef GOOGLE_PROTOBUF_INCLUDED_raft_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_raft_2eproto
 
+#include <limits>
 #include <string>
 
-#include <google/protobuf/stubs/common.h>
-
-#if GOOGLE_PROTOBUF_VERSION < 3005000
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please update
+#error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3005000 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please
+#error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
 #endif
 
+#include <google/protobuf/port_undef.inc>
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
 #include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/metadata.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
 #include <google/protobuf/repeated_field.h>  // IWYU pragma: export
 #include <google/protobuf/extension_set.h>  // IWYU pragma: export
 #include <google/protobuf/generated_enum_reflection.h>
 #include <google/protobuf/unknown_field_set.h>
 // @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_raft_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
 
-namespace protobuf_raft_2eproto {
 // Internal implementation detail -- do not use these members.
-struct TableStruct {
-  static const ::google::protobuf::internal::ParseTableField entries[];
-  static const ::google::protobuf::internal::AuxillaryParseTableField aux[];
-  static const ::google::protobuf::internal::ParseTable schema[7];
-  static const ::google::protobuf::internal::FieldMetadata field_metadata[];
-  static const ::google::protobuf::internal::SerializationTable serialization_table[];
-  static const ::google::protobuf::uint32 offsets[];
+struct TableStruct_raft_2eproto {
+  static const uint32_t offsets[];
 };
-void AddDescriptors();
-void InitDefaultsEntryImpl();
-void InitDefaultsEntry();
-void InitDefaultsSnapshotMetadataImpl();
-void InitDefaultsSnapshotMetadata();
-void InitDefaultsSnapshotImpl();
-void InitDefaultsSnapshot();
-void InitDefaultsMessageImpl();
-void InitDefaultsMessage();
-void InitDefaultsHardStateImpl();
-void InitDefaultsHardState();
-void InitDefaultsConfStateImpl();
-void InitDefaultsConfState();
-void InitDefaultsConfChangeImpl();
-void InitDefaultsConfChange();
-inline void InitDefaults() {
-  InitDefaultsEntry();
-  InitDefaultsSnapshotMetadata();
-  InitDefaultsSnapshot();
-  InitDefaultsMessage();
-  InitDefaultsHardState();
-  InitDefaultsConfState();
-  InitDefaultsConfChange();
-}
-}  // namespace protobuf_raft_2eproto
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_raft_2eproto;
 namespace raftpb {
 class ConfChange;
-class ConfChangeDefaultTypeInternal;
+struct ConfChangeDefaultTypeInternal;
 extern ConfChangeDefaultTypeInternal _ConfChange_default_instance_;
 class ConfState;
-class ConfStateDefaultTypeInternal;
+struct ConfStateDefaultTypeInternal;
 extern ConfStateDefaultTypeInternal _ConfState_default_instance_;
 class Entry;
-class EntryDefaultTypeInternal;
+struct EntryDefaultTypeInternal;
 extern EntryDefaultTypeInternal _Entry_default_instance_;
+class GroupHeartbeat;
+struct GroupHeartbeatDefaultTypeInternal;
+extern GroupHeartbeatDefaultTypeInternal _GroupHeartbeat_default_instance_;
 class HardState;
-class HardStateDefaultTypeInternal;
+struct HardStateDefaultTypeInternal;
 extern HardStateDefaultTypeInternal _HardState_default_instance_;
+class HeartbeatBatch;
+struct HeartbeatBatchDefaultTypeInternal;
+extern HeartbeatBatchDefaultTypeInternal _HeartbeatBatch_default_instance_;
 class Message;
-class MessageDefaultTypeInternal;
+struct MessageDefaultTypeInternal;
 extern MessageDefaultTypeInternal _Message_default_instance_;
 class Snapshot;
-class SnapshotDefaultTypeInternal;
+struct SnapshotDefaultTypeInternal;
 extern SnapshotDefaultTypeInternal _Snapshot_default_instance_;
 class SnapshotMetadata;
-class SnapshotMetadataDefaultTypeInternal;
+struct SnapshotMetadataDefaultTypeInternal;
 extern SnapshotMetadataDefaultTypeInternal _SnapshotMetadata_default_instance_;
 }  // namespace raftpb
+PROTOBUF_NAMESPACE_OPEN
+template<> ::raftpb::ConfChange* Arena::CreateMaybeMessage<::raftpb::ConfChange>(Arena*);
+template<> ::raftpb::ConfState* Arena::CreateMaybeMessage<::raftpb::ConfState>(Arena*);
+template<> ::raftpb::Entry* Arena::CreateMaybeMessage<::raftpb::Entry>(Arena*);
+template<> ::raftpb::GroupHeartbeat* Arena::CreateMaybeMessage<::raftpb::GroupHeartbeat>(Arena*);
+template<> ::raftpb::HardState* Arena::CreateMaybeMessage<::raftpb::HardState>(Arena*);
+template<> ::raftpb::HeartbeatBatch* Arena::CreateMaybeMessage<::raftpb::HeartbeatBatch>(Arena*);
+template<> ::raftpb::Message* Arena::CreateMaybeMessage<::raftpb::Message>(Arena*);
+template<> ::raftpb::Snapshot* Arena::CreateMaybeMessage<::raftpb::Snapshot>(Arena*);
+template<> ::raftpb::SnapshotMetadata* Arena::CreateMaybeMessage<::raftpb::SnapshotMetadata>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
 namespace raftpb {
 
-enum EntryType {
+enum EntryType : int {
   EntryNormal = 0,
   EntryConfChange = 1,
-  EntryType_INT_MIN_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32min,
-  EntryType_INT_MAX_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32max
+  EntryType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  EntryType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool EntryType_IsValid(int value);
-const EntryType EntryType_MIN = EntryNormal;
-const EntryType EntryType_MAX = EntryConfChange;
-const int EntryType_ARRAYSIZE = EntryType_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* EntryType_descriptor();
-inline const ::std::string& EntryType_Name(EntryType value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    EntryType_descriptor(), value);
+constexpr EntryType EntryType_MIN = EntryNormal;
+constexpr EntryType EntryType_MAX = EntryConfChange;
+constexpr int EntryType_ARRAYSIZE = EntryType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* EntryType_descriptor();
+template<typename T>
+inline const std::string& EntryType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, EntryType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function EntryType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    EntryType_descriptor(), enum_t_value);
 }
 inline bool EntryType_Parse(
-    const ::std::string& name, EntryType* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<EntryType>(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, EntryType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<EntryType>(
     EntryType_descriptor(), name, value);
 }
-enum MessageType {
+enum MessageType : int {
   MsgHup = 0,
   MsgBeat = 1,
   MsgProp = 2,
@@ -133,961 +132,1845 @@ enum MessageType {
   MsgReadIndexResp = 16,
   MsgPreVote = 17,
   MsgPreVoteResp = 18,
-  MessageType_INT_MIN_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32min,
-  MessageType_INT_MAX_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32max
+  MessageType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  MessageType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool MessageType_IsValid(int value);
-const MessageType MessageType_MIN = MsgHup;
-const MessageType MessageType_MAX = MsgPreVoteResp;
-const int MessageType_ARRAYSIZE = MessageType_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* MessageType_descriptor();
-inline const ::std::string& MessageType_Name(MessageType value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    MessageType_descriptor(), value);
+constexpr MessageType MessageType_MIN = MsgHup;
+constexpr MessageType MessageType_MAX = MsgPreVoteResp;
+constexpr int MessageType_ARRAYSIZE = MessageType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* MessageType_descriptor();
+template<typename T>
+inline const std::string& MessageType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, MessageType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function MessageType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    MessageType_descriptor(), enum_t_value);
 }
 inline bool MessageType_Parse(
-    const ::std::string& name, MessageType* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<MessageType>(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, MessageType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<MessageType>(
     MessageType_descriptor(), name, value);
 }
-enum ConfChangeType {
+enum ConfChangeType : int {
   ConfChangeAddNode = 0,
   ConfChangeRemoveNode = 1,
   ConfChangeUpdateNode = 2,
   ConfChangeAddLearnerNode = 3,
-  ConfChangeType_INT_MIN_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32min,
-  ConfChangeType_INT_MAX_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32max
+  ConfChangeType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  ConfChangeType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool ConfChangeType_IsValid(int value);
-const ConfChangeType ConfChangeType_MIN = ConfChangeAddNode;
-const ConfChangeType ConfChangeType_MAX = ConfChangeAddLearnerNode;
-const int ConfChangeType_ARRAYSIZE = ConfChangeType_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* ConfChangeType_descriptor();
-inline const ::std::string& ConfChangeType_Name(ConfChangeType value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    ConfChangeType_descriptor(), value);
+constexpr ConfChangeType ConfChangeType_MIN = ConfChangeAddNode;
+constexpr ConfChangeType ConfChangeType_MAX = ConfChangeAddLearnerNode;
+constexpr int ConfChangeType_ARRAYSIZE = ConfChangeType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ConfChangeType_descriptor();
+template<typename T>
+inline const std::string& ConfChangeType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, ConfChangeType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function ConfChangeType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    ConfChangeType_descriptor(), enum_t_value);
 }
 inline bool ConfChangeType_Parse(
-    const ::std::string& name, ConfChangeType* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<ConfChangeType>(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, ConfChangeType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<ConfChangeType>(
     ConfChangeType_descriptor(), name, value);
 }
 // ===================================================================
 
-class Entry : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:raftpb.Entry) */ {
+class Entry final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftpb.Entry) */ {
  public:
-  Entry();
-  virtual ~Entry();
+  inline Entry() : Entry(nullptr) {}
+  ~Entry() override;
+  explicit PROTOBUF_CONSTEXPR Entry(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Entry(const Entry& from);
-
-  inline Entry& operator=(const Entry& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   Entry(Entry&& from) noexcept
     : Entry() {
     *this = ::std::move(from);
   }
 
+  inline Entry& operator=(const Entry& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline Entry& operator=(Entry&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const Entry& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Entry& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const Entry* internal_default_instance() {
     return reinterpret_cast<const Entry*>(
                &_Entry_default_instance_);
   }
-  static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
+  static constexpr int kIndexInFileMessages =
     0;
 
-  void Swap(Entry* other);
   friend void swap(Entry& a, Entry& b) {
     a.Swap(&b);
   }
+  inline void Swap(Entry* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Entry* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline Entry* New() const PROTOBUF_FINAL { return New(NULL); }
-
-  Entry* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
-  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  Entry* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Entry>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Entry& from);
-  void MergeFrom(const Entry& from);
-  void Clear() PROTOBUF_FINAL;
-  bool IsInitialized() const PROTOBUF_FINAL;
-
-  size_t ByteSizeLong() const PROTOBUF_FINAL;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
-  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Entry& from) {
+    Entry::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void SetCachedSize(int size) const final;
   void InternalSwap(Entry* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftpb.Entry";
   }
+  protected:
+  explicit Entry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kDataFieldNumber = 4,
+    kTermFieldNumber = 2,
+    kIndexFieldNumber = 3,
+    kTypeFieldNumber = 1,
+  };
   // bytes Data = 4;
   void clear_data();
-  static const int kDataFieldNumber = 4;
-  const ::std::string& data() const;
-  void set_data(const ::std::string& value);
-  #if LANG_CXX11
-  void set_data(::std::string&& value);
-  #endif
-  void set_data(const char* value);
-  void set_data(const void* value, size_t size);
-  ::std::string* mutable_data();
-  ::std::string* release_data();
-  void set_allocated_data(::std::string* data);
+  const std::string& data() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_data(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_data();
+  PROTOBUF_NODISCARD std::string* release_data();
+  void set_allocated_data(std::string* data);
+  private:
+  const std::string& _internal_data() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_data(const std::string& value);
+  std::string* _internal_mutable_data();
+  public:
 
   // uint64 Term = 2;
   void clear_term();
-  static const int kTermFieldNumber = 2;
-  ::google::protobuf::uint64 term() const;
-  void set_term(::google::protobuf::uint64 value);
+  uint64_t term() const;
+  void set_term(uint64_t value);
+  private:
+  uint64_t _internal_term() const;
+  void _internal_set_term(uint64_t value);
+  public:
 
   // uint64 Index = 3;
   void clear_index();
-  static const int kIndexFieldNumber = 3;
-  ::google::protobuf::uint64 index() const;
-  void set_index(::google::protobuf::uint64 value);
+  uint64_t index() const;
+  void set_index(uint64_t value);
+  private:
+  uint64_t _internal_index() const;
+  void _internal_set_index(uint64_t value);
+  public:
 
   // .raftpb.EntryType Type = 1;
   void clear_type();
-  static const int kTypeFieldNumber = 1;
   ::raftpb::EntryType type() const;
   void set_type(::raftpb::EntryType value);
+  private:
+  ::raftpb::EntryType _internal_type() const;
+  void _internal_set_type(::raftpb::EntryType value);
+  public:
 
   // @@protoc_insertion_point(class_scope:raftpb.Entry)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr data_;
-  ::google::protobuf::uint64 term_;
-  ::google::protobuf::uint64 index_;
-  int type_;
-  mutable int _cached_size_;
-  friend struct ::protobuf_raft_2eproto::TableStruct;
-  friend void ::protobuf_raft_2eproto::InitDefaultsEntryImpl();
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr data_;
+    uint64_t term_;
+    uint64_t index_;
+    int type_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_raft_2eproto;
 };
 // -------------------------------------------------------------------
 
-class SnapshotMetadata : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:raftpb.SnapshotMetadata) */ {
+class SnapshotMetadata final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftpb.SnapshotMetadata) */ {
  public:
-  SnapshotMetadata();
-  virtual ~SnapshotMetadata();
+  inline SnapshotMetadata() : SnapshotMetadata(nullptr) {}
+  ~SnapshotMetadata() override;
+  explicit PROTOBUF_CONSTEXPR SnapshotMetadata(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   SnapshotMetadata(const SnapshotMetadata& from);
-
-  inline SnapshotMetadata& operator=(const SnapshotMetadata& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   SnapshotMetadata(SnapshotMetadata&& from) noexcept
     : SnapshotMetadata() {
     *this = ::std::move(from);
   }
 
+  inline SnapshotMetadata& operator=(const SnapshotMetadata& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline SnapshotMetadata& operator=(SnapshotMetadata&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const SnapshotMetadata& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SnapshotMetadata& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const SnapshotMetadata* internal_default_instance() {
     return reinterpret_cast<const SnapshotMetadata*>(
                &_SnapshotMetadata_default_instance_);
   }
-  static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
+  static constexpr int kIndexInFileMessages =
     1;
 
-  void Swap(SnapshotMetadata* other);
   friend void swap(SnapshotMetadata& a, SnapshotMetadata& b) {
     a.Swap(&b);
   }
+  inline void Swap(SnapshotMetadata* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SnapshotMetadata* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline SnapshotMetadata* New() const PROTOBUF_FINAL { return New(NULL); }
-
-  SnapshotMetadata* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
-  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  SnapshotMetadata* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SnapshotMetadata>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const SnapshotMetadata& from);
-  void MergeFrom(const SnapshotMetadata& from);
-  void Clear() PROTOBUF_FINAL;
-  bool IsInitialized() const PROTOBUF_FINAL;
-
-  size_t ByteSizeLong() const PROTOBUF_FINAL;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
-  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SnapshotMetadata& from) {
+    SnapshotMetadata::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void SetCachedSize(int size) const final;
   void InternalSwap(SnapshotMetadata* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftpb.SnapshotMetadata";
   }
+  protected:
+  explicit SnapshotMetadata(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kConfStateFieldNumber = 1,
+    kIndexFieldNumber = 2,
+    kTermFieldNumber = 3,
+  };
   // .raftpb.ConfState ConfState = 1;
   bool has_confstate() const;
+  private:
+  bool _internal_has_confstate() const;
+  public:
   void clear_confstate();
-  static const int kConfStateFieldNumber = 1;
   const ::raftpb::ConfState& confstate() const;
-  ::raftpb::ConfState* release_confstate();
+  PROTOBUF_NODISCARD ::raftpb::ConfState* release_confstate();
   ::raftpb::ConfState* mutable_confstate();
   void set_allocated_confstate(::raftpb::ConfState* confstate);
+  private:
+  const ::raftpb::ConfState& _internal_confstate() const;
+  ::raftpb::ConfState* _internal_mutable_confstate();
+  public:
+  void unsafe_arena_set_allocated_confstate(
+      ::raftpb::ConfState* confstate);
+  ::raftpb::ConfState* unsafe_arena_release_confstate();
 
   // uint64 Index = 2;
   void clear_index();
-  static const int kIndexFieldNumber = 2;
-  ::google::protobuf::uint64 index() const;
-  void set_index(::google::protobuf::uint64 value);
+  uint64_t index() const;
+  void set_index(uint64_t value);
+  private:
+  uint64_t _internal_index() const;
+  void _internal_set_index(uint64_t value);
+  public:
 
   // uint64 Term = 3;
   void clear_term();
-  static const int kTermFieldNumber = 3;
-  ::google::protobuf::uint64 term() const;
-  void set_term(::google::protobuf::uint64 value);
+  uint64_t term() const;
+  void set_term(uint64_t value);
+  private:
+  uint64_t _internal_term() const;
+  void _internal_set_term(uint64_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:raftpb.SnapshotMetadata)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::raftpb::ConfState* confstate_;
-  ::google::protobuf::uint64 index_;
-  ::google::protobuf::uint64 term_;
-  mutable int _cached_size_;
-  friend struct ::protobuf_raft_2eproto::TableStruct;
-  friend void ::protobuf_raft_2eproto::InitDefaultsSnapshotMetadataImpl();
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::raftpb::ConfState* confstate_;
+    uint64_t index_;
+    uint64_t term_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_raft_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Snapshot : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:raftpb.Snapshot) */ {
+class Snapshot final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftpb.Snapshot) */ {
  public:
-  Snapshot();
-  virtual ~Snapshot();
+  inline Snapshot() : Snapshot(nullptr) {}
+  ~Snapshot() override;
+  explicit PROTOBUF_CONSTEXPR Snapshot(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Snapshot(const Snapshot& from);
-
-  inline Snapshot& operator=(const Snapshot& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   Snapshot(Snapshot&& from) noexcept
     : Snapshot() {
     *this = ::std::move(from);
   }
 
+  inline Snapshot& operator=(const Snapshot& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline Snapshot& operator=(Snapshot&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const Snapshot& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Snapshot& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const Snapshot* internal_default_instance() {
     return reinterpret_cast<const Snapshot*>(
                &_Snapshot_default_instance_);
   }
-  static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
+  static constexpr int kIndexInFileMessages =
     2;
 
-  void Swap(Snapshot* other);
   friend void swap(Snapshot& a, Snapshot& b) {
     a.Swap(&b);
   }
+  inline void Swap(Snapshot* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Snapshot* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline Snapshot* New() const PROTOBUF_FINAL { return New(NULL); }
-
-  Snapshot* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
-  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  Snapshot* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Snapshot>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Snapshot& from);
-  void MergeFrom(const Snapshot& from);
-  void Clear() PROTOBUF_FINAL;
-  bool IsInitialized() const PROTOBUF_FINAL;
-
-  size_t ByteSizeLong() const PROTOBUF_FINAL;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
-  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Snapshot& from) {
+    Snapshot::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void SetCachedSize(int size) const final;
   void InternalSwap(Snapshot* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftpb.Snapshot";
   }
+  protected:
+  explicit Snapshot(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kDataFieldNumber = 1,
+    kMetadataFieldNumber = 2,
+  };
   // bytes Data = 1;
   void clear_data();
-  static const int kDataFieldNumber = 1;
-  const ::std::string& data() const;
-  void set_data(const ::std::string& value);
-  #if LANG_CXX11
-  void set_data(::std::string&& value);
-  #endif
-  void set_data(const char* value);
-  void set_data(const void* value, size_t size);
-  ::std::string* mutable_data();
-  ::std::string* release_data();
-  void set_allocated_data(::std::string* data);
+  const std::string& data() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_data(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_data();
+  PROTOBUF_NODISCARD std::string* release_data();
+  void set_allocated_data(std::string* data);
+  private:
+  const std::string& _internal_data() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_data(const std::string& value);
+  std::string* _internal_mutable_data();
+  public:
 
   // .raftpb.SnapshotMetadata Metadata = 2;
   bool has_metadata() const;
+  private:
+  bool _internal_has_metadata() const;
+  public:
   void clear_metadata();
-  static const int kMetadataFieldNumber = 2;
   const ::raftpb::SnapshotMetadata& metadata() const;
-  ::raftpb::SnapshotMetadata* release_metadata();
+  PROTOBUF_NODISCARD ::raftpb::SnapshotMetadata* release_metadata();
   ::raftpb::SnapshotMetadata* mutable_metadata();
   void set_allocated_metadata(::raftpb::SnapshotMetadata* metadata);
+  private:
+  const ::raftpb::SnapshotMetadata& _internal_metadata() const;
+  ::raftpb::SnapshotMetadata* _internal_mutable_metadata();
+  public:
+  void unsafe_arena_set_allocated_metadata(
+      ::raftpb::SnapshotMetadata* metadata);
+  ::raftpb::SnapshotMetadata* unsafe_arena_release_metadata();
 
   // @@protoc_insertion_point(class_scope:raftpb.Snapshot)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr data_;
-  ::raftpb::SnapshotMetadata* metadata_;
-  mutable int _cached_size_;
-  friend struct ::protobuf_raft_2eproto::TableStruct;
-  friend void ::protobuf_raft_2eproto::InitDefaultsSnapshotImpl();
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr data_;
+    ::raftpb::SnapshotMetadata* metadata_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_raft_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Message : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:raftpb.Message) */ {
+class Message final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftpb.Message) */ {
  public:
-  Message();
-  virtual ~Message();
+  inline Message() : Message(nullptr) {}
+  ~Message() override;
+  explicit PROTOBUF_CONSTEXPR Message(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Message(const Message& from);
-
-  inline Message& operator=(const Message& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   Message(Message&& from) noexcept
     : Message() {
     *this = ::std::move(from);
   }
 
+  inline Message& operator=(const Message& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline Message& operator=(Message&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const Message& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Message& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const Message* internal_default_instance() {
     return reinterpret_cast<const Message*>(
                &_Message_default_instance_);
   }
-  static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
+  static constexpr int kIndexInFileMessages =
     3;
 
-  void Swap(Message* other);
   friend void swap(Message& a, Message& b) {
     a.Swap(&b);
   }
+  inline void Swap(Message* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Message* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline Message* New() const PROTOBUF_FINAL { return New(NULL); }
-
-  Message* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
-  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  Message* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Message>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Message& from);
-  void MergeFrom(const Message& from);
-  void Clear() PROTOBUF_FINAL;
-  bool IsInitialized() const PROTOBUF_FINAL;
-
-  size_t ByteSizeLong() const PROTOBUF_FINAL;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
-  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Message& from) {
+    Message::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void SetCachedSize(int size) const final;
   void InternalSwap(Message* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftpb.Message";
   }
+  protected:
+  explicit Message(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kEntriesFieldNumber = 7,
+    kContextFieldNumber = 12,
+    kSnapshotFieldNumber = 9,
+    kToFieldNumber = 2,
+    kFromFieldNumber = 3,
+    kTermFieldNumber = 4,
+    kLogTermFieldNumber = 5,
+    kTypeFieldNumber = 1,
+    kRejectFieldNumber = 10,
+    kIndexFieldNumber = 6,
+    kCommitFieldNumber = 8,
+    kRejectHintFieldNumber = 11,
+  };
   // repeated .raftpb.Entry Entries = 7;
   int entries_size() const;
+  private:
+  int _internal_entries_size() const;
+  public:
   void clear_entries();
-  static const int kEntriesFieldNumber = 7;
-  const ::raftpb::Entry& entries(int index) const;
   ::raftpb::Entry* mutable_entries(int index);
-  ::raftpb::Entry* add_entries();
-  ::google::protobuf::RepeatedPtrField< ::raftpb::Entry >*
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftpb::Entry >*
       mutable_entries();
-  const ::google::protobuf::RepeatedPtrField< ::raftpb::Entry >&
+  private:
+  const ::raftpb::Entry& _internal_entries(int index) const;
+  ::raftpb::Entry* _internal_add_entries();
+  public:
+  const ::raftpb::Entry& entries(int index) const;
+  ::raftpb::Entry* add_entries();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftpb::Entry >&
       entries() const;
 
   // bytes Context = 12;
   void clear_context();
-  static const int kContextFieldNumber = 12;
-  const ::std::string& context() const;
-  void set_context(const ::std::string& value);
-  #if LANG_CXX11
-  void set_context(::std::string&& value);
-  #endif
-  void set_context(const char* value);
-  void set_context(const void* value, size_t size);
-  ::std::string* mutable_context();
-  ::std::string* release_context();
-  void set_allocated_context(::std::string* context);
+  const std::string& context() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_context(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_context();
+  PROTOBUF_NODISCARD std::string* release_context();
+  void set_allocated_context(std::string* context);
+  private:
+  const std::string& _internal_context() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_context(const std::string& value);
+  std::string* _internal_mutable_context();
+  public:
 
   // .raftpb.Snapshot Snapshot = 9;
   bool has_snapshot() const;
+  private:
+  bool _internal_has_snapshot() const;
+  public:
   void clear_snapshot();
-  static const int kSnapshotFieldNumber = 9;
   const ::raftpb::Snapshot& snapshot() const;
-  ::raftpb::Snapshot* release_snapshot();
+  PROTOBUF_NODISCARD ::raftpb::Snapshot* release_snapshot();
   ::raftpb::Snapshot* mutable_snapshot();
   void set_allocated_snapshot(::raftpb::Snapshot* snapshot);
+  private:
+  const ::raftpb::Snapshot& _internal_snapshot() const;
+  ::raftpb::Snapshot* _internal_mutable_snapshot();
+  public:
+  void unsafe_arena_set_allocated_snapshot(
+      ::raftpb::Snapshot* snapshot);
+  ::raftpb::Snapshot* unsafe_arena_release_snapshot();
 
   // uint64 To = 2;
   void clear_to();
-  static const int kToFieldNumber = 2;
-  ::google::protobuf::uint64 to() const;
-  void set_to(::google::protobuf::uint64 value);
+  uint64_t to() const;
+  void set_to(uint64_t value);
+  private:
+  uint64_t _internal_to() const;
+  void _internal_set_to(uint64_t value);
+  public:
 
   // uint64 From = 3;
   void clear_from();
-  static const int kFromFieldNumber = 3;
-  ::google::protobuf::uint64 from() const;
-  void set_from(::google::protobuf::uint64 value);
+  uint64_t from() const;
+  void set_from(uint64_t value);
+  private:
+  uint64_t _internal_from() const;
+  void _internal_set_from(uint64_t value);
+  public:
 
   // uint64 Term = 4;
   void clear_term();
-  static const int kTermFieldNumber = 4;
-  ::google::protobuf::uint64 term() const;
-  void set_term(::google::protobuf::uint64 value);
+  uint64_t term() const;
+  void set_term(uint64_t value);
+  private:
+  uint64_t _internal_term() const;
+  void _internal_set_term(uint64_t value);
+  public:
 
   // uint64 LogTerm = 5;
   void clear_logterm();
-  static const int kLogTermFieldNumber = 5;
-  ::google::protobuf::uint64 logterm() const;
-  void set_logterm(::google::protobuf::uint64 value);
+  uint64_t logterm() const;
+  void set_logterm(uint64_t value);
+  private:
+  uint64_t _internal_logterm() const;
+  void _internal_set_logterm(uint64_t value);
+  public:
 
   // .raftpb.MessageType Type = 1;
   void clear_type();
-  static const int kTypeFieldNumber = 1;
   ::raftpb::MessageType type() const;
   void set_type(::raftpb::MessageType value);
+  private:
+  ::raftpb::MessageType _internal_type() const;
+  void _internal_set_type(::raftpb::MessageType value);
+  public:
 
   // bool Reject = 10;
   void clear_reject();
-  static const int kRejectFieldNumber = 10;
   bool reject() const;
   void set_reject(bool value);
+  private:
+  bool _internal_reject() const;
+  void _internal_set_reject(bool value);
+  public:
 
   // uint64 Index = 6;
   void clear_index();
-  static const int kIndexFieldNumber = 6;
-  ::google::protobuf::uint64 index() const;
-  void set_index(::google::protobuf::uint64 value);
+  uint64_t index() const;
+  void set_index(uint64_t value);
+  private:
+  uint64_t _internal_index() const;
+  void _internal_set_index(uint64_t value);
+  public:
 
   // uint64 Commit = 8;
   void clear_commit();
-  static const int kCommitFieldNumber = 8;
-  ::google::protobuf::uint64 commit() const;
-  void set_commit(::google::protobuf::uint64 value);
+  uint64_t commit() const;
+  void set_commit(uint64_t value);
+  private:
+  uint64_t _internal_commit() const;
+  void _internal_set_commit(uint64_t value);
+  public:
 
   // uint64 RejectHint = 11;
   void clear_rejecthint();
-  static const int kRejectHintFieldNumber = 11;
-  ::google::protobuf::uint64 rejecthint() const;
-  void set_rejecthint(::google::protobuf::uint64 value);
+  uint64_t rejecthint() const;
+  void set_rejecthint(uint64_t value);
+  private:
+  uint64_t _internal_rejecthint() const;
+  void _internal_set_rejecthint(uint64_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:raftpb.Message)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::RepeatedPtrField< ::raftpb::Entry > entries_;
-  ::google::protobuf::internal::ArenaStringPtr context_;
-  ::raftpb::Snapshot* snapshot_;
-  ::google::protobuf::uint64 to_;
-  ::google::protobuf::uint64 from_;
-  ::google::protobuf::uint64 term_;
-  ::google::protobuf::uint64 logterm_;
-  int type_;
-  bool reject_;
-  ::google::protobuf::uint64 index_;
-  ::google::protobuf::uint64 commit_;
-  ::google::protobuf::uint64 rejecthint_;
-  mutable int _cached_size_;
-  friend struct ::protobuf_raft_2eproto::TableStruct;
-  friend void ::protobuf_raft_2eproto::InitDefaultsMessageImpl();
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftpb::Entry > entries_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr context_;
+    ::raftpb::Snapshot* snapshot_;
+    uint64_t to_;
+    uint64_t from_;
+    uint64_t term_;
+    uint64_t logterm_;
+    int type_;
+    bool reject_;
+    uint64_t index_;
+    uint64_t commit_;
+    uint64_t rejecthint_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_raft_2eproto;
 };
 // -------------------------------------------------------------------
 
-class HardState : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:raftpb.HardState) */ {
+class HardState final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftpb.HardState) */ {
  public:
-  HardState();
-  virtual ~HardState();
+  inline HardState() : HardState(nullptr) {}
+  ~HardState() override;
+  explicit PROTOBUF_CONSTEXPR HardState(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   HardState(const HardState& from);
-
-  inline HardState& operator=(const HardState& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   HardState(HardState&& from) noexcept
     : HardState() {
     *this = ::std::move(from);
   }
 
+  inline HardState& operator=(const HardState& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline HardState& operator=(HardState&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const HardState& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const HardState& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const HardState* internal_default_instance() {
     return reinterpret_cast<const HardState*>(
                &_HardState_default_instance_);
   }
-  static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
+  static constexpr int kIndexInFileMessages =
     4;
 
-  void Swap(HardState* other);
   friend void swap(HardState& a, HardState& b) {
     a.Swap(&b);
   }
+  inline void Swap(HardState* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(HardState* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline HardState* New() const PROTOBUF_FINAL { return New(NULL); }
-
-  HardState* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
-  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  HardState* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<HardState>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const HardState& from);
-  void MergeFrom(const HardState& from);
-  void Clear() PROTOBUF_FINAL;
-  bool IsInitialized() const PROTOBUF_FINAL;
-
-  size_t ByteSizeLong() const PROTOBUF_FINAL;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
-  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const HardState& from) {
+    HardState::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void SetCachedSize(int size) const final;
   void InternalSwap(HardState* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftpb.HardState";
   }
+  protected:
+  explicit HardState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kTermFieldNumber = 1,
+    kVoteFieldNumber = 2,
+    kCommitFieldNumber = 3,
+  };
   // uint64 Term = 1;
   void clear_term();
-  static const int kTermFieldNumber = 1;
-  ::google::protobuf::uint64 term() const;
-  void set_term(::google::protobuf::uint64 value);
+  uint64_t term() const;
+  void set_term(uint64_t value);
+  private:
+  uint64_t _internal_term() const;
+  void _internal_set_term(uint64_t value);
+  public:
 
   // uint64 Vote = 2;
   void clear_vote();
-  static const int kVoteFieldNumber = 2;
-  ::google::protobuf::uint64 vote() const;
-  void set_vote(::google::protobuf::uint64 value);
+  uint64_t vote() const;
+  void set_vote(uint64_t value);
+  private:
+  uint64_t _internal_vote() const;
+  void _internal_set_vote(uint64_t value);
+  public:
 
   // uint64 Commit = 3;
   void clear_commit();
-  static const int kCommitFieldNumber = 3;
-  ::google::protobuf::uint64 commit() const;
-  void set_commit(::google::protobuf::uint64 value);
+  uint64_t commit() const;
+  void set_commit(uint64_t value);
+  private:
+  uint64_t _internal_commit() const;
+  void _internal_set_commit(uint64_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:raftpb.HardState)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::uint64 term_;
-  ::google::protobuf::uint64 vote_;
-  ::google::protobuf::uint64 commit_;
-  mutable int _cached_size_;
-  friend struct ::protobuf_raft_2eproto::TableStruct;
-  friend void ::protobuf_raft_2eproto::InitDefaultsHardStateImpl();
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint64_t term_;
+    uint64_t vote_;
+    uint64_t commit_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_raft_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ConfState : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:raftpb.ConfState) */ {
+class ConfState final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftpb.ConfState) */ {
  public:
-  ConfState();
-  virtual ~ConfState();
+  inline ConfState() : ConfState(nullptr) {}
+  ~ConfState() override;
+  explicit PROTOBUF_CONSTEXPR ConfState(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   ConfState(const ConfState& from);
-
-  inline ConfState& operator=(const ConfState& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   ConfState(ConfState&& from) noexcept
     : ConfState() {
     *this = ::std::move(from);
   }
 
+  inline ConfState& operator=(const ConfState& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline ConfState& operator=(ConfState&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const ConfState& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ConfState& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const ConfState* internal_default_instance() {
     return reinterpret_cast<const ConfState*>(
                &_ConfState_default_instance_);
   }
-  static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
+  static constexpr int kIndexInFileMessages =
     5;
 
-  void Swap(ConfState* other);
   friend void swap(ConfState& a, ConfState& b) {
     a.Swap(&b);
   }
+  inline void Swap(ConfState* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ConfState* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline ConfState* New() const PROTOBUF_FINAL { return New(NULL); }
-
-  ConfState* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
-  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  ConfState* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ConfState>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const ConfState& from);
-  void MergeFrom(const ConfState& from);
-  void Clear() PROTOBUF_FINAL;
-  bool IsInitialized() const PROTOBUF_FINAL;
-
-  size_t ByteSizeLong() const PROTOBUF_FINAL;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
-  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ConfState& from) {
+    ConfState::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void SetCachedSize(int size) const final;
   void InternalSwap(ConfState* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftpb.ConfState";
   }
+  protected:
+  explicit ConfState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kNodesFieldNumber = 1,
+    kLearnersFieldNumber = 2,
+  };
   // repeated uint64 Nodes = 1;
   int nodes_size() const;
+  private:
+  int _internal_nodes_size() const;
+  public:
   void clear_nodes();
-  static const int kNodesFieldNumber = 1;
-  ::google::protobuf::uint64 nodes(int index) const;
-  void set_nodes(int index, ::google::protobuf::uint64 value);
-  void add_nodes(::google::protobuf::uint64 value);
-  const ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >&
+  private:
+  uint64_t _internal_nodes(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_nodes() const;
+  void _internal_add_nodes(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_nodes();
+  public:
+  uint64_t nodes(int index) const;
+  void set_nodes(int index, uint64_t value);
+  void add_nodes(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
       nodes() const;
-  ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >*
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
       mutable_nodes();
 
   // repeated uint64 Learners = 2;
   int learners_size() const;
+  private:
+  int _internal_learners_size() const;
+  public:
   void clear_learners();
-  static const int kLearnersFieldNumber = 2;
-  ::google::protobuf::uint64 learners(int index) const;
-  void set_learners(int index, ::google::protobuf::uint64 value);
-  void add_learners(::google::protobuf::uint64 value);
-  const ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >&
+  private:
+  uint64_t _internal_learners(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_learners() const;
+  void _internal_add_learners(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_learners();
+  public:
+  uint64_t learners(int index) const;
+  void set_learners(int index, uint64_t value);
+  void add_learners(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
       learners() const;
-  ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >*
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
       mutable_learners();
 
   // @@protoc_insertion_point(class_scope:raftpb.ConfState)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::RepeatedField< ::google::protobuf::uint64 > nodes_;
-  mutable int _nodes_cached_byte_size_;
-  ::google::protobuf::RepeatedField< ::google::protobuf::uint64 > learners_;
-  mutable int _learners_cached_byte_size_;
-  mutable int _cached_size_;
-  friend struct ::protobuf_raft_2eproto::TableStruct;
-  friend void ::protobuf_raft_2eproto::InitDefaultsConfStateImpl();
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > nodes_;
+    mutable std::atomic<int> _nodes_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > learners_;
+    mutable std::atomic<int> _learners_cached_byte_size_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_raft_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ConfChange : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:raftpb.ConfChange) */ {
+class ConfChange final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftpb.ConfChange) */ {
  public:
-  ConfChange();
-  virtual ~ConfChange();
+  inline ConfChange() : ConfChange(nullptr) {}
+  ~ConfChange() override;
+  explicit PROTOBUF_CONSTEXPR ConfChange(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   ConfChange(const ConfChange& from);
-
-  inline ConfChange& operator=(const ConfChange& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   ConfChange(ConfChange&& from) noexcept
     : ConfChange() {
     *this = ::std::move(from);
   }
 
+  inline ConfChange& operator=(const ConfChange& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline ConfChange& operator=(ConfChange&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const ConfChange& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const ConfChange* internal_default_instance() {
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ConfChange& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ConfChange* internal_default_instance() {
     return reinterpret_cast<const ConfChange*>(
                &_ConfChange_default_instance_);
   }
-  static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
+  static constexpr int kIndexInFileMessages =
     6;
 
-  void Swap(ConfChange* other);
   friend void swap(ConfChange& a, ConfChange& b) {
     a.Swap(&b);
   }
+  inline void Swap(ConfChange* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ConfChange* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline ConfChange* New() const PROTOBUF_FINAL { return New(NULL); }
-
-  ConfChange* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
-  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
-  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  ConfChange* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ConfChange>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const ConfChange& from);
-  void MergeFrom(const ConfChange& from);
-  void Clear() PROTOBUF_FINAL;
-  bool IsInitialized() const PROTOBUF_FINAL;
-
-  size_t ByteSizeLong() const PROTOBUF_FINAL;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
-  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ConfChange& from) {
+    ConfChange::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void SetCachedSize(int size) const final;
   void InternalSwap(ConfChange* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftpb.ConfChange";
   }
+  protected:
+  explicit ConfChange(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kContextFieldNumber = 4,
+    kIDFieldNumber = 1,
+    kNodeIDFieldNumber = 3,
+    kTypeFieldNumber = 2,
+  };
   // bytes Context = 4;
   void clear_context();
-  static const int kContextFieldNumber = 4;
-  const ::std::string& context() const;
-  void set_context(const ::std::string& value);
-  #if LANG_CXX11
-  void set_context(::std::string&& value);
-  #endif
-  void set_context(const char* value);
-  void set_context(const void* value, size_t size);
-  ::std::string* mutable_context();
-  ::std::string* release_context();
-  void set_allocated_context(::std::string* context);
+  const std::string& context() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_context(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_context();
+  PROTOBUF_NODISCARD std::string* release_context();
+  void set_allocated_context(std::string* context);
+  private:
+  const std::string& _internal_context() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_context(const std::string& value);
+  std::string* _internal_mutable_context();
+  public:
 
   // uint64 ID = 1;
   void clear_id();
-  static const int kIDFieldNumber = 1;
-  ::google::protobuf::uint64 id() const;
-  void set_id(::google::protobuf::uint64 value);
+  uint64_t id() const;
+  void set_id(uint64_t value);
+  private:
+  uint64_t _internal_id() const;
+  void _internal_set_id(uint64_t value);
+  public:
 
   // uint64 NodeID = 3;
   void clear_nodeid();
-  static const int kNodeIDFieldNumber = 3;
-  ::google::protobuf::uint64 nodeid() const;
-  void set_nodeid(::google::protobuf::uint64 value);
+  uint64_t nodeid() const;
+  void set_nodeid(uint64_t value);
+  private:
+  uint64_t _internal_nodeid() const;
+  void _internal_set_nodeid(uint64_t value);
+  public:
 
   // .raftpb.ConfChangeType Type = 2;
   void clear_type();
-  static const int kTypeFieldNumber = 2;
   ::raftpb::ConfChangeType type() const;
   void set_type(::raftpb::ConfChangeType value);
+  private:
+  ::raftpb::ConfChangeType _internal_type() const;
+  void _internal_set_type(::raftpb::ConfChangeType value);
+  public:
 
   // @@protoc_insertion_point(class_scope:raftpb.ConfChange)
  private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr context_;
+    uint64_t id_;
+    uint64_t nodeid_;
+    int type_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_raft_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GroupHeartbeat final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftpb.GroupHeartbeat) */ {
+ public:
+  inline GroupHeartbeat() : GroupHeartbeat(nullptr) {}
+  ~GroupHeartbeat() override;
+  explicit PROTOBUF_CONSTEXPR GroupHeartbeat(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  GroupHeartbeat(const GroupHeartbeat& from);
+  GroupHeartbeat(GroupHeartbeat&& from) noexcept
+    : GroupHeartbeat() {
+    *this = ::std::move(from);
+  }
+
+  inline GroupHeartbeat& operator=(const GroupHeartbeat& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GroupHeartbeat& operator=(GroupHeartbeat&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GroupHeartbeat& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GroupHeartbeat* internal_default_instance() {
+    return reinterpret_cast<const GroupHeartbeat*>(
+               &_GroupHeartbeat_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(GroupHeartbeat& a, GroupHeartbeat& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GroupHeartbeat* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GroupHeartbeat* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  GroupHeartbeat* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GroupHeartbeat>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const GroupHeartbeat& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GroupHeartbeat& from) {
+    GroupHeartbeat::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GroupHeartbeat* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftpb.GroupHeartbeat";
+  }
+  protected:
+  explicit GroupHeartbeat(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kContextFieldNumber = 7,
+    kGroupIDFieldNumber = 1,
+    kFromFieldNumber = 2,
+    kToFieldNumber = 3,
+    kTermFieldNumber = 4,
+    kCommitFieldNumber = 5,
+    kQuiesceFieldNumber = 6,
+  };
+  // bytes Context = 7;
+  void clear_context();
+  const std::string& context() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_context(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_context();
+  PROTOBUF_NODISCARD std::string* release_context();
+  void set_allocated_context(std::string* context);
+  private:
+  const std::string& _internal_context() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_context(const std::string& value);
+  std::string* _internal_mutable_context();
+  public:
+
+  // uint64 GroupID = 1;
+  void clear_groupid();
+  uint64_t groupid() const;
+  void set_groupid(uint64_t value);
+  private:
+  uint64_t _internal_groupid() const;
+  void _internal_set_groupid(uint64_t value);
+  public:
+
+  // uint64 From = 2;
+  void clear_from();
+  uint64_t from() const;
+  void set_from(uint64_t value);
+  private:
+  uint64_t _internal_from() const;
+  void _internal_set_from(uint64_t value);
+  public:
 
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr context_;
-  ::google::protobuf::uint64 id_;
-  ::google::protobuf::uint64 nodeid_;
-  int type_;
-  mutable int _cached_size_;
-  friend struct ::protobuf_raft_2eproto::TableStruct;
-  friend void ::protobuf_raft_2eproto::InitDefaultsConfChangeImpl();
+  // uint64 To = 3;
+  void clear_to();
+  uint64_t to() const;
+  void set_to(uint64_t value);
+  private:
+  uint64_t _internal_to() const;
+  void _internal_set_to(uint64_t value);
+  public:
+
+  // uint64 Term = 4;
+  void clear_term();
+  uint64_t term() const;
+  void set_term(uint64_t value);
+  private:
+  uint64_t _internal_term() const;
+  void _internal_set_term(uint64_t value);
+  public:
+
+  // uint64 Commit = 5;
+  void clear_commit();
+  uint64_t commit() const;
+  void set_commit(uint64_t value);
+  private:
+  uint64_t _internal_commit() const;
+  void _internal_set_commit(uint64_t value);
+  public:
+
+  // bool Quiesce = 6;
+  void clear_quiesce();
+  bool quiesce() const;
+  void set_quiesce(bool value);
+  private:
+  bool _internal_quiesce() const;
+  void _internal_set_quiesce(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftpb.GroupHeartbeat)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr context_;
+    uint64_t groupid_;
+    uint64_t from_;
+    uint64_t to_;
+    uint64_t term_;
+    uint64_t commit_;
+    bool quiesce_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_raft_2eproto;
+};
+// -------------------------------------------------------------------
+
+class HeartbeatBatch final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftpb.HeartbeatBatch) */ {
+ public:
+  inline HeartbeatBatch() : HeartbeatBatch(nullptr) {}
+  ~HeartbeatBatch() override;
+  explicit PROTOBUF_CONSTEXPR HeartbeatBatch(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  HeartbeatBatch(const HeartbeatBatch& from);
+  HeartbeatBatch(HeartbeatBatch&& from) noexcept
+    : HeartbeatBatch() {
+    *this = ::std::move(from);
+  }
+
+  inline HeartbeatBatch& operator=(const HeartbeatBatch& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline HeartbeatBatch& operator=(HeartbeatBatch&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const HeartbeatBatch& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const HeartbeatBatch* internal_default_instance() {
+    return reinterpret_cast<const HeartbeatBatch*>(
+               &_HeartbeatBatch_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  friend void swap(HeartbeatBatch& a, HeartbeatBatch& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(HeartbeatBatch* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(HeartbeatBatch* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  HeartbeatBatch* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<HeartbeatBatch>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const HeartbeatBatch& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const HeartbeatBatch& from) {
+    HeartbeatBatch::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(HeartbeatBatch* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftpb.HeartbeatBatch";
+  }
+  protected:
+  explicit HeartbeatBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kHeartbeatsFieldNumber = 3,
+    kResponsesFieldNumber = 4,
+    kFromFieldNumber = 1,
+    kToFieldNumber = 2,
+  };
+  // repeated .raftpb.GroupHeartbeat Heartbeats = 3;
+  int heartbeats_size() const;
+  private:
+  int _internal_heartbeats_size() const;
+  public:
+  void clear_heartbeats();
+  ::raftpb::GroupHeartbeat* mutable_heartbeats(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftpb::GroupHeartbeat >*
+      mutable_heartbeats();
+  private:
+  const ::raftpb::GroupHeartbeat& _internal_heartbeats(int index) const;
+  ::raftpb::GroupHeartbeat* _internal_add_heartbeats();
+  public:
+  const ::raftpb::GroupHeartbeat& heartbeats(int index) const;
+  ::raftpb::GroupHeartbeat* add_heartbeats();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftpb::GroupHeartbeat >&
+      heartbeats() const;
+
+  // repeated .raftpb.GroupHeartbeat Responses = 4;
+  int responses_size() const;
+  private:
+  int _internal_responses_size() const;
+  public:
+  void clear_responses();
+  ::raftpb::GroupHeartbeat* mutable_responses(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftpb::GroupHeartbeat >*
+      mutable_responses();
+  private:
+  const ::raftpb::GroupHeartbeat& _internal_responses(int index) const;
+  ::raftpb::GroupHeartbeat* _internal_add_responses();
+  public:
+  const ::raftpb::GroupHeartbeat& responses(int index) const;
+  ::raftpb::GroupHeartbeat* add_responses();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftpb::GroupHeartbeat >&
+      responses() const;
+
+  // uint64 From = 1;
+  void clear_from();
+  uint64_t from() const;
+  void set_from(uint64_t value);
+  private:
+  uint64_t _internal_from() const;
+  void _internal_set_from(uint64_t value);
+  public:
+
+  // uint64 To = 2;
+  void clear_to();
+  uint64_t to() const;
+  void set_to(uint64_t value);
+  private:
+  uint64_t _internal_to() const;
+  void _internal_set_to(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftpb.HeartbeatBatch)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftpb::GroupHeartbeat > heartbeats_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftpb::GroupHeartbeat > responses_;
+    uint64_t from_;
+    uint64_t to_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_raft_2eproto;
 };
 // ===================================================================
 
@@ -1102,96 +1985,111 @@ class ConfChange : public ::google::protobuf::Message /* @@protoc_insertion_poin
 
 // uint64 Term = 2;
 inline void Entry::clear_term() {
-  term_ = GOOGLE_ULONGLONG(0);
+  _impl_.term_ = uint64_t{0u};
+}
+inline uint64_t Entry::_internal_term() const {
+  return _impl_.term_;
 }
-inline ::google::protobuf::uint64 Entry::term() const {
+inline uint64_t Entry::term() const {
   // @@protoc_insertion_point(field_get:raftpb.Entry.Term)
-  return term_;
+  return _internal_term();
 }
-inline void Entry::set_term(::google::protobuf::uint64 value) {
+inline void Entry::_internal_set_term(uint64_t value) {
   
-  term_ = value;
+  _impl_.term_ = value;
+}
+inline void Entry::set_term(uint64_t value) {
+  _internal_set_term(value);
   // @@protoc_insertion_point(field_set:raftpb.Entry.Term)
 }
 
 // uint64 Index = 3;
 inline void Entry::clear_index() {
-  index_ = GOOGLE_ULONGLONG(0);
+  _impl_.index_ = uint64_t{0u};
+}
+inline uint64_t Entry::_internal_index() const {
+  return _impl_.index_;
 }
-inline ::google::protobuf::uint64 Entry::index() const {
+inline uint64_t Entry::index() const {
   // @@protoc_insertion_point(field_get:raftpb.Entry.Index)
-  return index_;
+  return _internal_index();
 }
-inline void Entry::set_index(::google::protobuf::uint64 value) {
+inline void Entry::_internal_set_index(uint64_t value) {
   
-  index_ = value;
+  _impl_.index_ = value;
+}
+inline void Entry::set_index(uint64_t value) {
+  _internal_set_index(value);
   // @@protoc_insertion_point(field_set:raftpb.Entry.Index)
 }
 
 // .raftpb.EntryType Type = 1;
 inline void Entry::clear_type() {
-  type_ = 0;
+  _impl_.type_ = 0;
+}
+inline ::raftpb::EntryType Entry::_internal_type() const {
+  return static_cast< ::raftpb::EntryType >(_impl_.type_);
 }
 inline ::raftpb::EntryType Entry::type() const {
   // @@protoc_insertion_point(field_get:raftpb.Entry.Type)
-  return static_cast< ::raftpb::EntryType >(type_);
+  return _internal_type();
 }
-inline void Entry::set_type(::raftpb::EntryType value) {
+inline void Entry::_internal_set_type(::raftpb::EntryType value) {
   
-  type_ = value;
+  _impl_.type_ = value;
+}
+inline void Entry::set_type(::raftpb::EntryType value) {
+  _internal_set_type(value);
   // @@protoc_insertion_point(field_set:raftpb.Entry.Type)
 }
 
 // bytes Data = 4;
 inline void Entry::clear_data() {
-  data_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.data_.ClearToEmpty();
 }
-inline const ::std::string& Entry::data() const {
+inline const std::string& Entry::data() const {
   // @@protoc_insertion_point(field_get:raftpb.Entry.Data)
-  return data_.GetNoArena();
+  return _internal_data();
 }
-inline void Entry::set_data(const ::std::string& value) {
-  
-  data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Entry::set_data(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.data_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:raftpb.Entry.Data)
 }
-#if LANG_CXX11
-inline void Entry::set_data(::std::string&& value) {
-  
-  data_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:raftpb.Entry.Data)
+inline std::string* Entry::mutable_data() {
+  std::string* _s = _internal_mutable_data();
+  // @@protoc_insertion_point(field_mutable:raftpb.Entry.Data)
+  return _s;
 }
-#endif
-inline void Entry::set_data(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:raftpb.Entry.Data)
+inline const std::string& Entry::_internal_data() const {
+  return _impl_.data_.Get();
 }
-inline void Entry::set_data(const void* value, size_t size) {
+inline void Entry::_internal_set_data(const std::string& value) {
   
-  data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:raftpb.Entry.Data)
+  _impl_.data_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* Entry::mutable_data() {
+inline std::string* Entry::_internal_mutable_data() {
   
-  // @@protoc_insertion_point(field_mutable:raftpb.Entry.Data)
-  return data_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.data_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* Entry::release_data() {
+inline std::string* Entry::release_data() {
   // @@protoc_insertion_point(field_release:raftpb.Entry.Data)
-  
-  return data_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.data_.Release();
 }
-inline void Entry::set_allocated_data(::std::string* data) {
-  if (data != NULL) {
+inline void Entry::set_allocated_data(std::string* data) {
+  if (data != nullptr) {
     
   } else {
     
   }
-  data_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), data);
+  _impl_.data_.SetAllocated(data, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.data_.IsDefault()) {
+    _impl_.data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:raftpb.Entry.Data)
 }
 
@@ -1200,80 +2098,132 @@ inline void Entry::set_allocated_data(::std::string* data) {
 // SnapshotMetadata
 
 // .raftpb.ConfState ConfState = 1;
+inline bool SnapshotMetadata::_internal_has_confstate() const {
+  return this != internal_default_instance() && _impl_.confstate_ != nullptr;
+}
 inline bool SnapshotMetadata::has_confstate() const {
-  return this != internal_default_instance() && confstate_ != NULL;
+  return _internal_has_confstate();
 }
 inline void SnapshotMetadata::clear_confstate() {
-  if (GetArenaNoVirtual() == NULL && confstate_ != NULL) {
-    delete confstate_;
+  if (GetArenaForAllocation() == nullptr && _impl_.confstate_ != nullptr) {
+    delete _impl_.confstate_;
   }
-  confstate_ = NULL;
+  _impl_.confstate_ = nullptr;
+}
+inline const ::raftpb::ConfState& SnapshotMetadata::_internal_confstate() const {
+  const ::raftpb::ConfState* p = _impl_.confstate_;
+  return p != nullptr ? *p : reinterpret_cast<const ::raftpb::ConfState&>(
+      ::raftpb::_ConfState_default_instance_);
 }
 inline const ::raftpb::ConfState& SnapshotMetadata::confstate() const {
-  const ::raftpb::ConfState* p = confstate_;
   // @@protoc_insertion_point(field_get:raftpb.SnapshotMetadata.ConfState)
-  return p != NULL ? *p : *reinterpret_cast<const ::raftpb::ConfState*>(
-      &::raftpb::_ConfState_default_instance_);
+  return _internal_confstate();
+}
+inline void SnapshotMetadata::unsafe_arena_set_allocated_confstate(
+    ::raftpb::ConfState* confstate) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.confstate_);
+  }
+  _impl_.confstate_ = confstate;
+  if (confstate) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:raftpb.SnapshotMetadata.ConfState)
 }
 inline ::raftpb::ConfState* SnapshotMetadata::release_confstate() {
+  
+  ::raftpb::ConfState* temp = _impl_.confstate_;
+  _impl_.confstate_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::raftpb::ConfState* SnapshotMetadata::unsafe_arena_release_confstate() {
   // @@protoc_insertion_point(field_release:raftpb.SnapshotMetadata.ConfState)
   
-  ::raftpb::ConfState* temp = confstate_;
-  confstate_ = NULL;
+  ::raftpb::ConfState* temp = _impl_.confstate_;
+  _impl_.confstate_ = nullptr;
   return temp;
 }
-inline ::raftpb::ConfState* SnapshotMetadata::mutable_confstate() {
+inline ::raftpb::ConfState* SnapshotMetadata::_internal_mutable_confstate() {
   
-  if (confstate_ == NULL) {
-    confstate_ = new ::raftpb::ConfState;
+  if (_impl_.confstate_ == nullptr) {
+    auto* p = CreateMaybeMessage<::raftpb::ConfState>(GetArenaForAllocation());
+    _impl_.confstate_ = p;
   }
+  return _impl_.confstate_;
+}
+inline ::raftpb::ConfState* SnapshotMetadata::mutable_confstate() {
+  ::raftpb::ConfState* _msg = _internal_mutable_confstate();
   // @@protoc_insertion_point(field_mutable:raftpb.SnapshotMetadata.ConfState)
-  return confstate_;
+  return _msg;
 }
 inline void SnapshotMetadata::set_allocated_confstate(::raftpb::ConfState* confstate) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete confstate_;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.confstate_;
   }
   if (confstate) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(confstate);
     if (message_arena != submessage_arena) {
-      confstate = ::google::protobuf::internal::GetOwnedMessage(
+      confstate = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, confstate, submessage_arena);
     }
     
   } else {
     
   }
-  confstate_ = confstate;
+  _impl_.confstate_ = confstate;
   // @@protoc_insertion_point(field_set_allocated:raftpb.SnapshotMetadata.ConfState)
 }
 
 // uint64 Index = 2;
 inline void SnapshotMetadata::clear_index() {
-  index_ = GOOGLE_ULONGLONG(0);
+  _impl_.index_ = uint64_t{0u};
+}
+inline uint64_t SnapshotMetadata::_internal_index() const {
+  return _impl_.index_;
 }
-inline ::google::protobuf::uint64 SnapshotMetadata::index() const {
+inline uint64_t SnapshotMetadata::index() const {
   // @@protoc_insertion_point(field_get:raftpb.SnapshotMetadata.Index)
-  return index_;
+  return _internal_index();
 }
-inline void SnapshotMetadata::set_index(::google::protobuf::uint64 value) {
+inline void SnapshotMetadata::_internal_set_index(uint64_t value) {
   
-  index_ = value;
+  _impl_.index_ = value;
+}
+inline void SnapshotMetadata::set_index(uint64_t value) {
+  _internal_set_index(value);
   // @@protoc_insertion_point(field_set:raftpb.SnapshotMetadata.Index)
 }
 
 // uint64 Term = 3;
 inline void SnapshotMetadata::clear_term() {
-  term_ = GOOGLE_ULONGLONG(0);
+  _impl_.term_ = uint64_t{0u};
+}
+inline uint64_t SnapshotMetadata::_internal_term() const {
+  return _impl_.term_;
 }
-inline ::google::protobuf::uint64 SnapshotMetadata::term() const {
+inline uint64_t SnapshotMetadata::term() const {
   // @@protoc_insertion_point(field_get:raftpb.SnapshotMetadata.Term)
-  return term_;
+  return _internal_term();
 }
-inline void SnapshotMetadata::set_term(::google::protobuf::uint64 value) {
+inline void SnapshotMetadata::_internal_set_term(uint64_t value) {
   
-  term_ = value;
+  _impl_.term_ = value;
+}
+inline void SnapshotMetadata::set_term(uint64_t value) {
+  _internal_set_term(value);
   // @@protoc_insertion_point(field_set:raftpb.SnapshotMetadata.Term)
 }
 
@@ -1283,104 +2233,141 @@ inline void SnapshotMetadata::set_term(::google::protobuf::uint64 value) {
 
 // bytes Data = 1;
 inline void Snapshot::clear_data() {
-  data_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.data_.ClearToEmpty();
 }
-inline const ::std::string& Snapshot::data() const {
+inline const std::string& Snapshot::data() const {
   // @@protoc_insertion_point(field_get:raftpb.Snapshot.Data)
-  return data_.GetNoArena();
+  return _internal_data();
 }
-inline void Snapshot::set_data(const ::std::string& value) {
-  
-  data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Snapshot::set_data(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.data_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:raftpb.Snapshot.Data)
 }
-#if LANG_CXX11
-inline void Snapshot::set_data(::std::string&& value) {
-  
-  data_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:raftpb.Snapshot.Data)
+inline std::string* Snapshot::mutable_data() {
+  std::string* _s = _internal_mutable_data();
+  // @@protoc_insertion_point(field_mutable:raftpb.Snapshot.Data)
+  return _s;
 }
-#endif
-inline void Snapshot::set_data(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:raftpb.Snapshot.Data)
+inline const std::string& Snapshot::_internal_data() const {
+  return _impl_.data_.Get();
 }
-inline void Snapshot::set_data(const void* value, size_t size) {
+inline void Snapshot::_internal_set_data(const std::string& value) {
   
-  data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:raftpb.Snapshot.Data)
+  _impl_.data_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* Snapshot::mutable_data() {
+inline std::string* Snapshot::_internal_mutable_data() {
   
-  // @@protoc_insertion_point(field_mutable:raftpb.Snapshot.Data)
-  return data_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.data_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* Snapshot::release_data() {
+inline std::string* Snapshot::release_data() {
   // @@protoc_insertion_point(field_release:raftpb.Snapshot.Data)
-  
-  return data_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.data_.Release();
 }
-inline void Snapshot::set_allocated_data(::std::string* data) {
-  if (data != NULL) {
+inline void Snapshot::set_allocated_data(std::string* data) {
+  if (data != nullptr) {
     
   } else {
     
   }
-  data_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), data);
+  _impl_.data_.SetAllocated(data, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.data_.IsDefault()) {
+    _impl_.data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:raftpb.Snapshot.Data)
 }
 
 // .raftpb.SnapshotMetadata Metadata = 2;
+inline bool Snapshot::_internal_has_metadata() const {
+  return this != internal_default_instance() && _impl_.metadata_ != nullptr;
+}
 inline bool Snapshot::has_metadata() const {
-  return this != internal_default_instance() && metadata_ != NULL;
+  return _internal_has_metadata();
 }
 inline void Snapshot::clear_metadata() {
-  if (GetArenaNoVirtual() == NULL && metadata_ != NULL) {
-    delete metadata_;
+  if (GetArenaForAllocation() == nullptr && _impl_.metadata_ != nullptr) {
+    delete _impl_.metadata_;
   }
-  metadata_ = NULL;
+  _impl_.metadata_ = nullptr;
+}
+inline const ::raftpb::SnapshotMetadata& Snapshot::_internal_metadata() const {
+  const ::raftpb::SnapshotMetadata* p = _impl_.metadata_;
+  return p != nullptr ? *p : reinterpret_cast<const ::raftpb::SnapshotMetadata&>(
+      ::raftpb::_SnapshotMetadata_default_instance_);
 }
 inline const ::raftpb::SnapshotMetadata& Snapshot::metadata() const {
-  const ::raftpb::SnapshotMetadata* p = metadata_;
   // @@protoc_insertion_point(field_get:raftpb.Snapshot.Metadata)
-  return p != NULL ? *p : *reinterpret_cast<const ::raftpb::SnapshotMetadata*>(
-      &::raftpb::_SnapshotMetadata_default_instance_);
+  return _internal_metadata();
+}
+inline void Snapshot::unsafe_arena_set_allocated_metadata(
+    ::raftpb::SnapshotMetadata* metadata) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.metadata_);
+  }
+  _impl_.metadata_ = metadata;
+  if (metadata) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:raftpb.Snapshot.Metadata)
 }
 inline ::raftpb::SnapshotMetadata* Snapshot::release_metadata() {
+  
+  ::raftpb::SnapshotMetadata* temp = _impl_.metadata_;
+  _impl_.metadata_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::raftpb::SnapshotMetadata* Snapshot::unsafe_arena_release_metadata() {
   // @@protoc_insertion_point(field_release:raftpb.Snapshot.Metadata)
   
-  ::raftpb::SnapshotMetadata* temp = metadata_;
-  metadata_ = NULL;
+  ::raftpb::SnapshotMetadata* temp = _impl_.metadata_;
+  _impl_.metadata_ = nullptr;
   return temp;
 }
-inline ::raftpb::SnapshotMetadata* Snapshot::mutable_metadata() {
+inline ::raftpb::SnapshotMetadata* Snapshot::_internal_mutable_metadata() {
   
-  if (metadata_ == NULL) {
-    metadata_ = new ::raftpb::SnapshotMetadata;
+  if (_impl_.metadata_ == nullptr) {
+    auto* p = CreateMaybeMessage<::raftpb::SnapshotMetadata>(GetArenaForAllocation());
+    _impl_.metadata_ = p;
   }
+  return _impl_.metadata_;
+}
+inline ::raftpb::SnapshotMetadata* Snapshot::mutable_metadata() {
+  ::raftpb::SnapshotMetadata* _msg = _internal_mutable_metadata();
   // @@protoc_insertion_point(field_mutable:raftpb.Snapshot.Metadata)
-  return metadata_;
+  return _msg;
 }
 inline void Snapshot::set_allocated_metadata(::raftpb::SnapshotMetadata* metadata) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete metadata_;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.metadata_;
   }
   if (metadata) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(metadata);
     if (message_arena != submessage_arena) {
-      metadata = ::google::protobuf::internal::GetOwnedMessage(
+      metadata = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, metadata, submessage_arena);
     }
     
   } else {
     
   }
-  metadata_ = metadata;
+  _impl_.metadata_ = metadata;
   // @@protoc_insertion_point(field_set_allocated:raftpb.Snapshot.Metadata)
 }
 
@@ -1390,260 +2377,361 @@ inline void Snapshot::set_allocated_metadata(::raftpb::SnapshotMetadata* metadat
 
 // .raftpb.MessageType Type = 1;
 inline void Message::clear_type() {
-  type_ = 0;
+  _impl_.type_ = 0;
+}
+inline ::raftpb::MessageType Message::_internal_type() const {
+  return static_cast< ::raftpb::MessageType >(_impl_.type_);
 }
 inline ::raftpb::MessageType Message::type() const {
   // @@protoc_insertion_point(field_get:raftpb.Message.Type)
-  return static_cast< ::raftpb::MessageType >(type_);
+  return _internal_type();
 }
-inline void Message::set_type(::raftpb::MessageType value) {
+inline void Message::_internal_set_type(::raftpb::MessageType value) {
   
-  type_ = value;
+  _impl_.type_ = value;
+}
+inline void Message::set_type(::raftpb::MessageType value) {
+  _internal_set_type(value);
   // @@protoc_insertion_point(field_set:raftpb.Message.Type)
 }
 
 // uint64 To = 2;
 inline void Message::clear_to() {
-  to_ = GOOGLE_ULONGLONG(0);
+  _impl_.to_ = uint64_t{0u};
 }
-inline ::google::protobuf::uint64 Message::to() const {
+inline uint64_t Message::_internal_to() const {
+  return _impl_.to_;
+}
+inline uint64_t Message::to() const {
   // @@protoc_insertion_point(field_get:raftpb.Message.To)
-  return to_;
+  return _internal_to();
 }
-inline void Message::set_to(::google::protobuf::uint64 value) {
+inline void Message::_internal_set_to(uint64_t value) {
   
-  to_ = value;
+  _impl_.to_ = value;
+}
+inline void Message::set_to(uint64_t value) {
+  _internal_set_to(value);
   // @@protoc_insertion_point(field_set:raftpb.Message.To)
 }
 
 // uint64 From = 3;
 inline void Message::clear_from() {
-  from_ = GOOGLE_ULONGLONG(0);
+  _impl_.from_ = uint64_t{0u};
+}
+inline uint64_t Message::_internal_from() const {
+  return _impl_.from_;
 }
-inline ::google::protobuf::uint64 Message::from() const {
+inline uint64_t Message::from() const {
   // @@protoc_insertion_point(field_get:raftpb.Message.From)
-  return from_;
+  return _internal_from();
 }
-inline void Message::set_from(::google::protobuf::uint64 value) {
+inline void Message::_internal_set_from(uint64_t value) {
   
-  from_ = value;
+  _impl_.from_ = value;
+}
+inline void Message::set_from(uint64_t value) {
+  _internal_set_from(value);
   // @@protoc_insertion_point(field_set:raftpb.Message.From)
 }
 
 // uint64 Term = 4;
 inline void Message::clear_term() {
-  term_ = GOOGLE_ULONGLONG(0);
+  _impl_.term_ = uint64_t{0u};
+}
+inline uint64_t Message::_internal_term() const {
+  return _impl_.term_;
 }
-inline ::google::protobuf::uint64 Message::term() const {
+inline uint64_t Message::term() const {
   // @@protoc_insertion_point(field_get:raftpb.Message.Term)
-  return term_;
+  return _internal_term();
 }
-inline void Message::set_term(::google::protobuf::uint64 value) {
+inline void Message::_internal_set_term(uint64_t value) {
   
-  term_ = value;
+  _impl_.term_ = value;
+}
+inline void Message::set_term(uint64_t value) {
+  _internal_set_term(value);
   // @@protoc_insertion_point(field_set:raftpb.Message.Term)
 }
 
 // uint64 LogTerm = 5;
 inline void Message::clear_logterm() {
-  logterm_ = GOOGLE_ULONGLONG(0);
+  _impl_.logterm_ = uint64_t{0u};
+}
+inline uint64_t Message::_internal_logterm() const {
+  return _impl_.logterm_;
 }
-inline ::google::protobuf::uint64 Message::logterm() const {
+inline uint64_t Message::logterm() const {
   // @@protoc_insertion_point(field_get:raftpb.Message.LogTerm)
-  return logterm_;
+  return _internal_logterm();
 }
-inline void Message::set_logterm(::google::protobuf::uint64 value) {
+inline void Message::_internal_set_logterm(uint64_t value) {
   
-  logterm_ = value;
+  _impl_.logterm_ = value;
+}
+inline void Message::set_logterm(uint64_t value) {
+  _internal_set_logterm(value);
   // @@protoc_insertion_point(field_set:raftpb.Message.LogTerm)
 }
 
 // uint64 Index = 6;
 inline void Message::clear_index() {
-  index_ = GOOGLE_ULONGLONG(0);
+  _impl_.index_ = uint64_t{0u};
+}
+inline uint64_t Message::_internal_index() const {
+  return _impl_.index_;
 }
-inline ::google::protobuf::uint64 Message::index() const {
+inline uint64_t Message::index() const {
   // @@protoc_insertion_point(field_get:raftpb.Message.Index)
-  return index_;
+  return _internal_index();
 }
-inline void Message::set_index(::google::protobuf::uint64 value) {
+inline void Message::_internal_set_index(uint64_t value) {
   
-  index_ = value;
+  _impl_.index_ = value;
+}
+inline void Message::set_index(uint64_t value) {
+  _internal_set_index(value);
   // @@protoc_insertion_point(field_set:raftpb.Message.Index)
 }
 
 // repeated .raftpb.Entry Entries = 7;
+inline int Message::_internal_entries_size() const {
+  return _impl_.entries_.size();
+}
 inline int Message::entries_size() const {
-  return entries_.size();
+  return _internal_entries_size();
 }
 inline void Message::clear_entries() {
-  entries_.Clear();
+  _impl_.entries_.Clear();
+}
+inline ::raftpb::Entry* Message::mutable_entries(int index) {
+  // @@protoc_insertion_point(field_mutable:raftpb.Message.Entries)
+  return _impl_.entries_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftpb::Entry >*
+Message::mutable_entries() {
+  // @@protoc_insertion_point(field_mutable_list:raftpb.Message.Entries)
+  return &_impl_.entries_;
+}
+inline const ::raftpb::Entry& Message::_internal_entries(int index) const {
+  return _impl_.entries_.Get(index);
 }
 inline const ::raftpb::Entry& Message::entries(int index) const {
   // @@protoc_insertion_point(field_get:raftpb.Message.Entries)
-  return entries_.Get(index);
+  return _internal_entries(index);
 }
-inline ::raftpb::Entry* Message::mutable_entries(int index) {
-  // @@protoc_insertion_point(field_mutable:raftpb.Message.Entries)
-  return entries_.Mutable(index);
+inline ::raftpb::Entry* Message::_internal_add_entries() {
+  return _impl_.entries_.Add();
 }
 inline ::raftpb::Entry* Message::add_entries() {
+  ::raftpb::Entry* _add = _internal_add_entries();
   // @@protoc_insertion_point(field_add:raftpb.Message.Entries)
-  return entries_.Add();
+  return _add;
 }
-inline ::google::protobuf::RepeatedPtrField< ::raftpb::Entry >*
-Message::mutable_entries() {
-  // @@protoc_insertion_point(field_mutable_list:raftpb.Message.Entries)
-  return &entries_;
-}
-inline const ::google::protobuf::RepeatedPtrField< ::raftpb::Entry >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftpb::Entry >&
 Message::entries() const {
   // @@protoc_insertion_point(field_list:raftpb.Message.Entries)
-  return entries_;
+  return _impl_.entries_;
 }
 
 // uint64 Commit = 8;
 inline void Message::clear_commit() {
-  commit_ = GOOGLE_ULONGLONG(0);
+  _impl_.commit_ = uint64_t{0u};
+}
+inline uint64_t Message::_internal_commit() const {
+  return _impl_.commit_;
 }
-inline ::google::protobuf::uint64 Message::commit() const {
+inline uint64_t Message::commit() const {
   // @@protoc_insertion_point(field_get:raftpb.Message.Commit)
-  return commit_;
+  return _internal_commit();
 }
-inline void Message::set_commit(::google::protobuf::uint64 value) {
+inline void Message::_internal_set_commit(uint64_t value) {
   
-  commit_ = value;
+  _impl_.commit_ = value;
+}
+inline void Message::set_commit(uint64_t value) {
+  _internal_set_commit(value);
   // @@protoc_insertion_point(field_set:raftpb.Message.Commit)
 }
 
 // .raftpb.Snapshot Snapshot = 9;
+inline bool Message::_internal_has_snapshot() const {
+  return this != internal_default_instance() && _impl_.snapshot_ != nullptr;
+}
 inline bool Message::has_snapshot() const {
-  return this != internal_default_instance() && snapshot_ != NULL;
+  return _internal_has_snapshot();
 }
 inline void Message::clear_snapshot() {
-  if (GetArenaNoVirtual() == NULL && snapshot_ != NULL) {
-    delete snapshot_;
+  if (GetArenaForAllocation() == nullptr && _impl_.snapshot_ != nullptr) {
+    delete _impl_.snapshot_;
   }
-  snapshot_ = NULL;
+  _impl_.snapshot_ = nullptr;
+}
+inline const ::raftpb::Snapshot& Message::_internal_snapshot() const {
+  const ::raftpb::Snapshot* p = _impl_.snapshot_;
+  return p != nullptr ? *p : reinterpret_cast<const ::raftpb::Snapshot&>(
+      ::raftpb::_Snapshot_default_instance_);
 }
 inline const ::raftpb::Snapshot& Message::snapshot() const {
-  const ::raftpb::Snapshot* p = snapshot_;
   // @@protoc_insertion_point(field_get:raftpb.Message.Snapshot)
-  return p != NULL ? *p : *reinterpret_cast<const ::raftpb::Snapshot*>(
-      &::raftpb::_Snapshot_default_instance_);
+  return _internal_snapshot();
+}
+inline void Message::unsafe_arena_set_allocated_snapshot(
+    ::raftpb::Snapshot* snapshot) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.snapshot_);
+  }
+  _impl_.snapshot_ = snapshot;
+  if (snapshot) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:raftpb.Message.Snapshot)
 }
 inline ::raftpb::Snapshot* Message::release_snapshot() {
+  
+  ::raftpb::Snapshot* temp = _impl_.snapshot_;
+  _impl_.snapshot_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::raftpb::Snapshot* Message::unsafe_arena_release_snapshot() {
   // @@protoc_insertion_point(field_release:raftpb.Message.Snapshot)
   
-  ::raftpb::Snapshot* temp = snapshot_;
-  snapshot_ = NULL;
+  ::raftpb::Snapshot* temp = _impl_.snapshot_;
+  _impl_.snapshot_ = nullptr;
   return temp;
 }
-inline ::raftpb::Snapshot* Message::mutable_snapshot() {
+inline ::raftpb::Snapshot* Message::_internal_mutable_snapshot() {
   
-  if (snapshot_ == NULL) {
-    snapshot_ = new ::raftpb::Snapshot;
+  if (_impl_.snapshot_ == nullptr) {
+    auto* p = CreateMaybeMessage<::raftpb::Snapshot>(GetArenaForAllocation());
+    _impl_.snapshot_ = p;
   }
+  return _impl_.snapshot_;
+}
+inline ::raftpb::Snapshot* Message::mutable_snapshot() {
+  ::raftpb::Snapshot* _msg = _internal_mutable_snapshot();
   // @@protoc_insertion_point(field_mutable:raftpb.Message.Snapshot)
-  return snapshot_;
+  return _msg;
 }
 inline void Message::set_allocated_snapshot(::raftpb::Snapshot* snapshot) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete snapshot_;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.snapshot_;
   }
   if (snapshot) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(snapshot);
     if (message_arena != submessage_arena) {
-      snapshot = ::google::protobuf::internal::GetOwnedMessage(
+      snapshot = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, snapshot, submessage_arena);
     }
     
   } else {
     
   }
-  snapshot_ = snapshot;
+  _impl_.snapshot_ = snapshot;
   // @@protoc_insertion_point(field_set_allocated:raftpb.Message.Snapshot)
 }
 
 // bool Reject = 10;
 inline void Message::clear_reject() {
-  reject_ = false;
+  _impl_.reject_ = false;
+}
+inline bool Message::_internal_reject() const {
+  return _impl_.reject_;
 }
 inline bool Message::reject() const {
   // @@protoc_insertion_point(field_get:raftpb.Message.Reject)
-  return reject_;
+  return _internal_reject();
 }
-inline void Message::set_reject(bool value) {
+inline void Message::_internal_set_reject(bool value) {
   
-  reject_ = value;
+  _impl_.reject_ = value;
+}
+inline void Message::set_reject(bool value) {
+  _internal_set_reject(value);
   // @@protoc_insertion_point(field_set:raftpb.Message.Reject)
 }
 
 // uint64 RejectHint = 11;
 inline void Message::clear_rejecthint() {
-  rejecthint_ = GOOGLE_ULONGLONG(0);
+  _impl_.rejecthint_ = uint64_t{0u};
 }
-inline ::google::protobuf::uint64 Message::rejecthint() const {
+inline uint64_t Message::_internal_rejecthint() const {
+  return _impl_.rejecthint_;
+}
+inline uint64_t Message::rejecthint() const {
   // @@protoc_insertion_point(field_get:raftpb.Message.RejectHint)
-  return rejecthint_;
+  return _internal_rejecthint();
 }
-inline void Message::set_rejecthint(::google::protobuf::uint64 value) {
+inline void Message::_internal_set_rejecthint(uint64_t value) {
   
-  rejecthint_ = value;
+  _impl_.rejecthint_ = value;
+}
+inline void Message::set_rejecthint(uint64_t value) {
+  _internal_set_rejecthint(value);
   // @@protoc_insertion_point(field_set:raftpb.Message.RejectHint)
 }
 
 // bytes Context = 12;
 inline void Message::clear_context() {
-  context_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.context_.ClearToEmpty();
 }
-inline const ::std::string& Message::context() const {
+inline const std::string& Message::context() const {
   // @@protoc_insertion_point(field_get:raftpb.Message.Context)
-  return context_.GetNoArena();
+  return _internal_context();
 }
-inline void Message::set_context(const ::std::string& value) {
-  
-  context_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Message::set_context(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.context_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:raftpb.Message.Context)
 }
-#if LANG_CXX11
-inline void Message::set_context(::std::string&& value) {
-  
-  context_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:raftpb.Message.Context)
+inline std::string* Message::mutable_context() {
+  std::string* _s = _internal_mutable_context();
+  // @@protoc_insertion_point(field_mutable:raftpb.Message.Context)
+  return _s;
 }
-#endif
-inline void Message::set_context(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  context_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:raftpb.Message.Context)
+inline const std::string& Message::_internal_context() const {
+  return _impl_.context_.Get();
 }
-inline void Message::set_context(const void* value, size_t size) {
+inline void Message::_internal_set_context(const std::string& value) {
   
-  context_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:raftpb.Message.Context)
+  _impl_.context_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* Message::mutable_context() {
+inline std::string* Message::_internal_mutable_context() {
   
-  // @@protoc_insertion_point(field_mutable:raftpb.Message.Context)
-  return context_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.context_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* Message::release_context() {
+inline std::string* Message::release_context() {
   // @@protoc_insertion_point(field_release:raftpb.Message.Context)
-  
-  return context_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.context_.Release();
 }
-inline void Message::set_allocated_context(::std::string* context) {
-  if (context != NULL) {
+inline void Message::set_allocated_context(std::string* context) {
+  if (context != nullptr) {
     
   } else {
     
   }
-  context_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), context);
+  _impl_.context_.SetAllocated(context, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.context_.IsDefault()) {
+    _impl_.context_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:raftpb.Message.Context)
 }
 
@@ -1653,43 +2741,61 @@ inline void Message::set_allocated_context(::std::string* context) {
 
 // uint64 Term = 1;
 inline void HardState::clear_term() {
-  term_ = GOOGLE_ULONGLONG(0);
+  _impl_.term_ = uint64_t{0u};
 }
-inline ::google::protobuf::uint64 HardState::term() const {
+inline uint64_t HardState::_internal_term() const {
+  return _impl_.term_;
+}
+inline uint64_t HardState::term() const {
   // @@protoc_insertion_point(field_get:raftpb.HardState.Term)
-  return term_;
+  return _internal_term();
 }
-inline void HardState::set_term(::google::protobuf::uint64 value) {
+inline void HardState::_internal_set_term(uint64_t value) {
   
-  term_ = value;
+  _impl_.term_ = value;
+}
+inline void HardState::set_term(uint64_t value) {
+  _internal_set_term(value);
   // @@protoc_insertion_point(field_set:raftpb.HardState.Term)
 }
 
 // uint64 Vote = 2;
 inline void HardState::clear_vote() {
-  vote_ = GOOGLE_ULONGLONG(0);
+  _impl_.vote_ = uint64_t{0u};
+}
+inline uint64_t HardState::_internal_vote() const {
+  return _impl_.vote_;
 }
-inline ::google::protobuf::uint64 HardState::vote() const {
+inline uint64_t HardState::vote() const {
   // @@protoc_insertion_point(field_get:raftpb.HardState.Vote)
-  return vote_;
+  return _internal_vote();
 }
-inline void HardState::set_vote(::google::protobuf::uint64 value) {
+inline void HardState::_internal_set_vote(uint64_t value) {
   
-  vote_ = value;
+  _impl_.vote_ = value;
+}
+inline void HardState::set_vote(uint64_t value) {
+  _internal_set_vote(value);
   // @@protoc_insertion_point(field_set:raftpb.HardState.Vote)
 }
 
 // uint64 Commit = 3;
 inline void HardState::clear_commit() {
-  commit_ = GOOGLE_ULONGLONG(0);
+  _impl_.commit_ = uint64_t{0u};
+}
+inline uint64_t HardState::_internal_commit() const {
+  return _impl_.commit_;
 }
-inline ::google::protobuf::uint64 HardState::commit() const {
+inline uint64_t HardState::commit() const {
   // @@protoc_insertion_point(field_get:raftpb.HardState.Commit)
-  return commit_;
+  return _internal_commit();
 }
-inline void HardState::set_commit(::google::protobuf::uint64 value) {
+inline void HardState::_internal_set_commit(uint64_t value) {
   
-  commit_ = value;
+  _impl_.commit_ = value;
+}
+inline void HardState::set_commit(uint64_t value) {
+  _internal_set_commit(value);
   // @@protoc_insertion_point(field_set:raftpb.HardState.Commit)
 }
 
@@ -1698,63 +2804,97 @@ inline void HardState::set_commit(::google::protobuf::uint64 value) {
 // ConfState
 
 // repeated uint64 Nodes = 1;
+inline int ConfState::_internal_nodes_size() const {
+  return _impl_.nodes_.size();
+}
 inline int ConfState::nodes_size() const {
-  return nodes_.size();
+  return _internal_nodes_size();
 }
 inline void ConfState::clear_nodes() {
-  nodes_.Clear();
+  _impl_.nodes_.Clear();
 }
-inline ::google::protobuf::uint64 ConfState::nodes(int index) const {
+inline uint64_t ConfState::_internal_nodes(int index) const {
+  return _impl_.nodes_.Get(index);
+}
+inline uint64_t ConfState::nodes(int index) const {
   // @@protoc_insertion_point(field_get:raftpb.ConfState.Nodes)
-  return nodes_.Get(index);
+  return _internal_nodes(index);
 }
-inline void ConfState::set_nodes(int index, ::google::protobuf::uint64 value) {
-  nodes_.Set(index, value);
+inline void ConfState::set_nodes(int index, uint64_t value) {
+  _impl_.nodes_.Set(index, value);
   // @@protoc_insertion_point(field_set:raftpb.ConfState.Nodes)
 }
-inline void ConfState::add_nodes(::google::protobuf::uint64 value) {
-  nodes_.Add(value);
+inline void ConfState::_internal_add_nodes(uint64_t value) {
+  _impl_.nodes_.Add(value);
+}
+inline void ConfState::add_nodes(uint64_t value) {
+  _internal_add_nodes(value);
   // @@protoc_insertion_point(field_add:raftpb.ConfState.Nodes)
 }
-inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+ConfState::_internal_nodes() const {
+  return _impl_.nodes_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
 ConfState::nodes() const {
   // @@protoc_insertion_point(field_list:raftpb.ConfState.Nodes)
-  return nodes_;
+  return _internal_nodes();
 }
-inline ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >*
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+ConfState::_internal_mutable_nodes() {
+  return &_impl_.nodes_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
 ConfState::mutable_nodes() {
   // @@protoc_insertion_point(field_mutable_list:raftpb.ConfState.Nodes)
-  return &nodes_;
+  return _internal_mutable_nodes();
 }
 
 // repeated uint64 Learners = 2;
+inline int ConfState::_internal_learners_size() const {
+  return _impl_.learners_.size();
+}
 inline int ConfState::learners_size() const {
-  return learners_.size();
+  return _internal_learners_size();
 }
 inline void ConfState::clear_learners() {
-  learners_.Clear();
+  _impl_.learners_.Clear();
 }
-inline ::google::protobuf::uint64 ConfState::learners(int index) const {
+inline uint64_t ConfState::_internal_learners(int index) const {
+  return _impl_.learners_.Get(index);
+}
+inline uint64_t ConfState::learners(int index) const {
   // @@protoc_insertion_point(field_get:raftpb.ConfState.Learners)
-  return learners_.Get(index);
+  return _internal_learners(index);
 }
-inline void ConfState::set_learners(int index, ::google::protobuf::uint64 value) {
-  learners_.Set(index, value);
+inline void ConfState::set_learners(int index, uint64_t value) {
+  _impl_.learners_.Set(index, value);
   // @@protoc_insertion_point(field_set:raftpb.ConfState.Learners)
 }
-inline void ConfState::add_learners(::google::protobuf::uint64 value) {
-  learners_.Add(value);
+inline void ConfState::_internal_add_learners(uint64_t value) {
+  _impl_.learners_.Add(value);
+}
+inline void ConfState::add_learners(uint64_t value) {
+  _internal_add_learners(value);
   // @@protoc_insertion_point(field_add:raftpb.ConfState.Learners)
 }
-inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+ConfState::_internal_learners() const {
+  return _impl_.learners_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
 ConfState::learners() const {
   // @@protoc_insertion_point(field_list:raftpb.ConfState.Learners)
-  return learners_;
+  return _internal_learners();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+ConfState::_internal_mutable_learners() {
+  return &_impl_.learners_;
 }
-inline ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >*
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
 ConfState::mutable_learners() {
   // @@protoc_insertion_point(field_mutable_list:raftpb.ConfState.Learners)
-  return &learners_;
+  return _internal_mutable_learners();
 }
 
 // -------------------------------------------------------------------
@@ -1763,97 +2903,410 @@ ConfState::mutable_learners() {
 
 // uint64 ID = 1;
 inline void ConfChange::clear_id() {
-  id_ = GOOGLE_ULONGLONG(0);
+  _impl_.id_ = uint64_t{0u};
+}
+inline uint64_t ConfChange::_internal_id() const {
+  return _impl_.id_;
 }
-inline ::google::protobuf::uint64 ConfChange::id() const {
+inline uint64_t ConfChange::id() const {
   // @@protoc_insertion_point(field_get:raftpb.ConfChange.ID)
-  return id_;
+  return _internal_id();
 }
-inline void ConfChange::set_id(::google::protobuf::uint64 value) {
+inline void ConfChange::_internal_set_id(uint64_t value) {
   
-  id_ = value;
+  _impl_.id_ = value;
+}
+inline void ConfChange::set_id(uint64_t value) {
+  _internal_set_id(value);
   // @@protoc_insertion_point(field_set:raftpb.ConfChange.ID)
 }
 
 // .raftpb.ConfChangeType Type = 2;
 inline void ConfChange::clear_type() {
-  type_ = 0;
+  _impl_.type_ = 0;
+}
+inline ::raftpb::ConfChangeType ConfChange::_internal_type() const {
+  return static_cast< ::raftpb::ConfChangeType >(_impl_.type_);
 }
 inline ::raftpb::ConfChangeType ConfChange::type() const {
   // @@protoc_insertion_point(field_get:raftpb.ConfChange.Type)
-  return static_cast< ::raftpb::ConfChangeType >(type_);
+  return _internal_type();
 }
-inline void ConfChange::set_type(::raftpb::ConfChangeType value) {
+inline void ConfChange::_internal_set_type(::raftpb::ConfChangeType value) {
   
-  type_ = value;
+  _impl_.type_ = value;
+}
+inline void ConfChange::set_type(::raftpb::ConfChangeType value) {
+  _internal_set_type(value);
   // @@protoc_insertion_point(field_set:raftpb.ConfChange.Type)
 }
 
 // uint64 NodeID = 3;
 inline void ConfChange::clear_nodeid() {
-  nodeid_ = GOOGLE_ULONGLONG(0);
+  _impl_.nodeid_ = uint64_t{0u};
+}
+inline uint64_t ConfChange::_internal_nodeid() const {
+  return _impl_.nodeid_;
 }
-inline ::google::protobuf::uint64 ConfChange::nodeid() const {
+inline uint64_t ConfChange::nodeid() const {
   // @@protoc_insertion_point(field_get:raftpb.ConfChange.NodeID)
-  return nodeid_;
+  return _internal_nodeid();
 }
-inline void ConfChange::set_nodeid(::google::protobuf::uint64 value) {
+inline void ConfChange::_internal_set_nodeid(uint64_t value) {
   
-  nodeid_ = value;
+  _impl_.nodeid_ = value;
+}
+inline void ConfChange::set_nodeid(uint64_t value) {
+  _internal_set_nodeid(value);
   // @@protoc_insertion_point(field_set:raftpb.ConfChange.NodeID)
 }
 
 // bytes Context = 4;
 inline void ConfChange::clear_context() {
-  context_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.context_.ClearToEmpty();
 }
-inline const ::std::string& ConfChange::context() const {
+inline const std::string& ConfChange::context() const {
   // @@protoc_insertion_point(field_get:raftpb.ConfChange.Context)
-  return context_.GetNoArena();
+  return _internal_context();
 }
-inline void ConfChange::set_context(const ::std::string& value) {
-  
-  context_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ConfChange::set_context(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.context_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:raftpb.ConfChange.Context)
 }
-#if LANG_CXX11
-inline void ConfChange::set_context(::std::string&& value) {
+inline std::string* ConfChange::mutable_context() {
+  std::string* _s = _internal_mutable_context();
+  // @@protoc_insertion_point(field_mutable:raftpb.ConfChange.Context)
+  return _s;
+}
+inline const std::string& ConfChange::_internal_context() const {
+  return _impl_.context_.Get();
+}
+inline void ConfChange::_internal_set_context(const std::string& value) {
   
-  context_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:raftpb.ConfChange.Context)
+  _impl_.context_.Set(value, GetArenaForAllocation());
 }
-#endif
-inline void ConfChange::set_context(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
+inline std::string* ConfChange::_internal_mutable_context() {
   
-  context_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:raftpb.ConfChange.Context)
+  return _impl_.context_.Mutable(GetArenaForAllocation());
 }
-inline void ConfChange::set_context(const void* value, size_t size) {
+inline std::string* ConfChange::release_context() {
+  // @@protoc_insertion_point(field_release:raftpb.ConfChange.Context)
+  return _impl_.context_.Release();
+}
+inline void ConfChange::set_allocated_context(std::string* context) {
+  if (context != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.context_.SetAllocated(context, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.context_.IsDefault()) {
+    _impl_.context_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftpb.ConfChange.Context)
+}
+
+// -------------------------------------------------------------------
+
+// GroupHeartbeat
+
+// uint64 GroupID = 1;
+inline void GroupHeartbeat::clear_groupid() {
+  _impl_.groupid_ = uint64_t{0u};
+}
+inline uint64_t GroupHeartbeat::_internal_groupid() const {
+  return _impl_.groupid_;
+}
+inline uint64_t GroupHeartbeat::groupid() const {
+  // @@protoc_insertion_point(field_get:raftpb.GroupHeartbeat.GroupID)
+  return _internal_groupid();
+}
+inline void GroupHeartbeat::_internal_set_groupid(uint64_t value) {
   
-  context_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:raftpb.ConfChange.Context)
+  _impl_.groupid_ = value;
+}
+inline void GroupHeartbeat::set_groupid(uint64_t value) {
+  _internal_set_groupid(value);
+  // @@protoc_insertion_point(field_set:raftpb.GroupHeartbeat.GroupID)
+}
+
+// uint64 From = 2;
+inline void GroupHeartbeat::clear_from() {
+  _impl_.from_ = uint64_t{0u};
 }
-inline ::std::string* ConfChange::mutable_context() {
+inline uint64_t GroupHeartbeat::_internal_from() const {
+  return _impl_.from_;
+}
+inline uint64_t GroupHeartbeat::from() const {
+  // @@protoc_insertion_point(field_get:raftpb.GroupHeartbeat.From)
+  return _internal_from();
+}
+inline void GroupHeartbeat::_internal_set_from(uint64_t value) {
   
-  // @@protoc_insertion_point(field_mutable:raftpb.ConfChange.Context)
-  return context_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.from_ = value;
 }
-inline ::std::string* ConfChange::release_context() {
-  // @@protoc_insertion_point(field_release:raftpb.ConfChange.Context)
+inline void GroupHeartbeat::set_from(uint64_t value) {
+  _internal_set_from(value);
+  // @@protoc_insertion_point(field_set:raftpb.GroupHeartbeat.From)
+}
+
+// uint64 To = 3;
+inline void GroupHeartbeat::clear_to() {
+  _impl_.to_ = uint64_t{0u};
+}
+inline uint64_t GroupHeartbeat::_internal_to() const {
+  return _impl_.to_;
+}
+inline uint64_t GroupHeartbeat::to() const {
+  // @@protoc_insertion_point(field_get:raftpb.GroupHeartbeat.To)
+  return _internal_to();
+}
+inline void GroupHeartbeat::_internal_set_to(uint64_t value) {
   
-  return context_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.to_ = value;
+}
+inline void GroupHeartbeat::set_to(uint64_t value) {
+  _internal_set_to(value);
+  // @@protoc_insertion_point(field_set:raftpb.GroupHeartbeat.To)
+}
+
+// uint64 Term = 4;
+inline void GroupHeartbeat::clear_term() {
+  _impl_.term_ = uint64_t{0u};
+}
+inline uint64_t GroupHeartbeat::_internal_term() const {
+  return _impl_.term_;
+}
+inline uint64_t GroupHeartbeat::term() const {
+  // @@protoc_insertion_point(field_get:raftpb.GroupHeartbeat.Term)
+  return _internal_term();
+}
+inline void GroupHeartbeat::_internal_set_term(uint64_t value) {
+  
+  _impl_.term_ = value;
+}
+inline void GroupHeartbeat::set_term(uint64_t value) {
+  _internal_set_term(value);
+  // @@protoc_insertion_point(field_set:raftpb.GroupHeartbeat.Term)
+}
+
+// uint64 Commit = 5;
+inline void GroupHeartbeat::clear_commit() {
+  _impl_.commit_ = uint64_t{0u};
+}
+inline uint64_t GroupHeartbeat::_internal_commit() const {
+  return _impl_.commit_;
+}
+inline uint64_t GroupHeartbeat::commit() const {
+  // @@protoc_insertion_point(field_get:raftpb.GroupHeartbeat.Commit)
+  return _internal_commit();
+}
+inline void GroupHeartbeat::_internal_set_commit(uint64_t value) {
+  
+  _impl_.commit_ = value;
+}
+inline void GroupHeartbeat::set_commit(uint64_t value) {
+  _internal_set_commit(value);
+  // @@protoc_insertion_point(field_set:raftpb.GroupHeartbeat.Commit)
+}
+
+// bool Quiesce = 6;
+inline void GroupHeartbeat::clear_quiesce() {
+  _impl_.quiesce_ = false;
+}
+inline bool GroupHeartbeat::_internal_quiesce() const {
+  return _impl_.quiesce_;
+}
+inline bool GroupHeartbeat::quiesce() const {
+  // @@protoc_insertion_point(field_get:raftpb.GroupHeartbeat.Quiesce)
+  return _internal_quiesce();
+}
+inline void GroupHeartbeat::_internal_set_quiesce(bool value) {
+  
+  _impl_.quiesce_ = value;
+}
+inline void GroupHeartbeat::set_quiesce(bool value) {
+  _internal_set_quiesce(value);
+  // @@protoc_insertion_point(field_set:raftpb.GroupHeartbeat.Quiesce)
+}
+
+// bytes Context = 7;
+inline void GroupHeartbeat::clear_context() {
+  _impl_.context_.ClearToEmpty();
+}
+inline const std::string& GroupHeartbeat::context() const {
+  // @@protoc_insertion_point(field_get:raftpb.GroupHeartbeat.Context)
+  return _internal_context();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GroupHeartbeat::set_context(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.context_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftpb.GroupHeartbeat.Context)
 }
-inline void ConfChange::set_allocated_context(::std::string* context) {
-  if (context != NULL) {
+inline std::string* GroupHeartbeat::mutable_context() {
+  std::string* _s = _internal_mutable_context();
+  // @@protoc_insertion_point(field_mutable:raftpb.GroupHeartbeat.Context)
+  return _s;
+}
+inline const std::string& GroupHeartbeat::_internal_context() const {
+  return _impl_.context_.Get();
+}
+inline void GroupHeartbeat::_internal_set_context(const std::string& value) {
+  
+  _impl_.context_.Set(value, GetArenaForAllocation());
+}
+inline std::string* GroupHeartbeat::_internal_mutable_context() {
+  
+  return _impl_.context_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GroupHeartbeat::release_context() {
+  // @@protoc_insertion_point(field_release:raftpb.GroupHeartbeat.Context)
+  return _impl_.context_.Release();
+}
+inline void GroupHeartbeat::set_allocated_context(std::string* context) {
+  if (context != nullptr) {
     
   } else {
     
   }
-  context_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), context);
-  // @@protoc_insertion_point(field_set_allocated:raftpb.ConfChange.Context)
+  _impl_.context_.SetAllocated(context, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.context_.IsDefault()) {
+    _impl_.context_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftpb.GroupHeartbeat.Context)
+}
+
+// -------------------------------------------------------------------
+
+// HeartbeatBatch
+
+// uint64 From = 1;
+inline void HeartbeatBatch::clear_from() {
+  _impl_.from_ = uint64_t{0u};
+}
+inline uint64_t HeartbeatBatch::_internal_from() const {
+  return _impl_.from_;
+}
+inline uint64_t HeartbeatBatch::from() const {
+  // @@protoc_insertion_point(field_get:raftpb.HeartbeatBatch.From)
+  return _internal_from();
+}
+inline void HeartbeatBatch::_internal_set_from(uint64_t value) {
+  
+  _impl_.from_ = value;
+}
+inline void HeartbeatBatch::set_from(uint64_t value) {
+  _internal_set_from(value);
+  // @@protoc_insertion_point(field_set:raftpb.HeartbeatBatch.From)
+}
+
+// uint64 To = 2;
+inline void HeartbeatBatch::clear_to() {
+  _impl_.to_ = uint64_t{0u};
+}
+inline uint64_t HeartbeatBatch::_internal_to() const {
+  return _impl_.to_;
+}
+inline uint64_t HeartbeatBatch::to() const {
+  // @@protoc_insertion_point(field_get:raftpb.HeartbeatBatch.To)
+  return _internal_to();
+}
+inline void HeartbeatBatch::_internal_set_to(uint64_t value) {
+  
+  _impl_.to_ = value;
+}
+inline void HeartbeatBatch::set_to(uint64_t value) {
+  _internal_set_to(value);
+  // @@protoc_insertion_point(field_set:raftpb.HeartbeatBatch.To)
+}
+
+// repeated .raftpb.GroupHeartbeat Heartbeats = 3;
+inline int HeartbeatBatch::_internal_heartbeats_size() const {
+  return _impl_.heartbeats_.size();
+}
+inline int HeartbeatBatch::heartbeats_size() const {
+  return _internal_heartbeats_size();
+}
+inline void HeartbeatBatch::clear_heartbeats() {
+  _impl_.heartbeats_.Clear();
+}
+inline ::raftpb::GroupHeartbeat* HeartbeatBatch::mutable_heartbeats(int index) {
+  // @@protoc_insertion_point(field_mutable:raftpb.HeartbeatBatch.Heartbeats)
+  return _impl_.heartbeats_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftpb::GroupHeartbeat >*
+HeartbeatBatch::mutable_heartbeats() {
+  // @@protoc_insertion_point(field_mutable_list:raftpb.HeartbeatBatch.Heartbeats)
+  return &_impl_.heartbeats_;
+}
+inline const ::raftpb::GroupHeartbeat& HeartbeatBatch::_internal_heartbeats(int index) const {
+  return _impl_.heartbeats_.Get(index);
+}
+inline const ::raftpb::GroupHeartbeat& HeartbeatBatch::heartbeats(int index) const {
+  // @@protoc_insertion_point(field_get:raftpb.HeartbeatBatch.Heartbeats)
+  return _internal_heartbeats(index);
+}
+inline ::raftpb::GroupHeartbeat* HeartbeatBatch::_internal_add_heartbeats() {
+  return _impl_.heartbeats_.Add();
+}
+inline ::raftpb::GroupHeartbeat* HeartbeatBatch::add_heartbeats() {
+  ::raftpb::GroupHeartbeat* _add = _internal_add_heartbeats();
+  // @@protoc_insertion_point(field_add:raftpb.HeartbeatBatch.Heartbeats)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftpb::GroupHeartbeat >&
+HeartbeatBatch::heartbeats() const {
+  // @@protoc_insertion_point(field_list:raftpb.HeartbeatBatch.Heartbeats)
+  return _impl_.heartbeats_;
+}
+
+// repeated .raftpb.GroupHeartbeat Responses = 4;
+inline int HeartbeatBatch::_internal_responses_size() const {
+  return _impl_.responses_.size();
+}
+inline int HeartbeatBatch::responses_size() const {
+  return _internal_responses_size();
+}
+inline void HeartbeatBatch::clear_responses() {
+  _impl_.responses_.Clear();
+}
+inline ::raftpb::GroupHeartbeat* HeartbeatBatch::mutable_responses(int index) {
+  // @@protoc_insertion_point(field_mutable:raftpb.HeartbeatBatch.Responses)
+  return _impl_.responses_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftpb::GroupHeartbeat >*
+HeartbeatBatch::mutable_responses() {
+  // @@protoc_insertion_point(field_mutable_list:raftpb.HeartbeatBatch.Responses)
+  return &_impl_.responses_;
+}
+inline const ::raftpb::GroupHeartbeat& HeartbeatBatch::_internal_responses(int index) const {
+  return _impl_.responses_.Get(index);
+}
+inline const ::raftpb::GroupHeartbeat& HeartbeatBatch::responses(int index) const {
+  // @@protoc_insertion_point(field_get:raftpb.HeartbeatBatch.Responses)
+  return _internal_responses(index);
+}
+inline ::raftpb::GroupHeartbeat* HeartbeatBatch::_internal_add_responses() {
+  return _impl_.responses_.Add();
+}
+inline ::raftpb::GroupHeartbeat* HeartbeatBatch::add_responses() {
+  ::raftpb::GroupHeartbeat* _add = _internal_add_responses();
+  // @@protoc_insertion_point(field_add:raftpb.HeartbeatBatch.Responses)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftpb::GroupHeartbeat >&
+HeartbeatBatch::responses() const {
+  // @@protoc_insertion_point(field_list:raftpb.HeartbeatBatch.Responses)
+  return _impl_.responses_;
 }
 
 #ifdef __GNUC__
@@ -1871,33 +3324,36 @@ inline void ConfChange::set_allocated_context(::std::string* context) {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
 }  // namespace raftpb
 
-namespace google {
-namespace protobuf {
+PROTOBUF_NAMESPACE_OPEN
 
-template <> struct is_proto_enum< ::raftpb::EntryType> : ::google::protobuf::internal::true_type {};
+template <> struct is_proto_enum< ::raftpb::EntryType> : ::std::true_type {};
 template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::raftpb::EntryType>() {
   return ::raftpb::EntryType_descriptor();
 }
-template <> struct is_proto_enum< ::raftpb::MessageType> : ::google::protobuf::internal::true_type {};
+template <> struct is_proto_enum< ::raftpb::MessageType> : ::std::true_type {};
 template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::raftpb::MessageType>() {
   return ::raftpb::MessageType_descriptor();
 }
-template <> struct is_proto_enum< ::raftpb::ConfChangeType> : ::google::protobuf::internal::true_type {};
+template <> struct is_proto_enum< ::raftpb::ConfChangeType> : ::std::true_type {};
 template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::raftpb::ConfChangeType>() {
   return ::raftpb::ConfChangeType_descriptor();
 }
 
-}  // namespace protobuf
-}  // namespace google
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
 
-#endif  // PROTOBUF_raft_2eproto__INCLUDED
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_raft_2eproto
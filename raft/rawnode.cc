@@ -0,0 +1,231 @@
+#include "rawnode.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace myraft {
+
+static bool IsHardStateEmpty(const raftpb::HardState& state) {
+  return 0 == state.term() && 0 == state.vote() && 0 == state.commit();
+}
+
+void Ready::Clear() {
+  soft_state.reset(nullptr);
+  hard_state.Clear();
+  read_states.clear();
+  entries.Clear();
+  snapshot.Clear();
+  committed_entries.Clear();
+  messages.clear();
+  messages_after_append.clear();
+  must_sync = false;
+}
+
+RawNode::RawNode(const Config& config)
+    : raft_(new Raft(config)) {
+  prev_soft_state_ = raft_->GetSoftState();
+  prev_hard_state_ = raft_->GetHardState();
+}
+
+void RawNode::Tick() {
+  raft_->Tick();
+}
+
+RawNode::Error RawNode::Campaign() {
+  std::unique_ptr<raftpb::Message> m(new raftpb::Message);
+  m->set_type(raftpb::MsgHup);
+  return raft_->Step(std::move(m));
+}
+
+RawNode::Error RawNode::Propose(const std::string& data) {
+  std::unique_ptr<raftpb::Message> m(new raftpb::Message);
+  m->set_type(raftpb::MsgProp);
+  m->set_from(raft_->Id());
+  m->add_entries()->set_data(data);
+  return raft_->Step(std::move(m));
+}
+
+RawNode::Error RawNode::ProposeConfChange(const raftpb::ConfChange& cc) {
+  std::unique_ptr<raftpb::Message> m(new raftpb::Message);
+  m->set_type(raftpb::MsgProp);
+  raftpb::Entry* entry = m->add_entries();
+  entry->set_type(raftpb::EntryConfChange);
+  if (!cc.SerializeToString(entry->mutable_data())) {
+    //Panicf
+  }
+  return raft_->Step(std::move(m));
+}
+
+RawNode::Error RawNode::Step(std::unique_ptr<raftpb::Message> m) {
+  if (IsLocalMsg(m->type())) {
+    return Raft::ErrStepLocalMsg;
+  }
+
+  const auto& prs = raft_->Progresses();
+  if (IsResponseMsg(m->type()) && prs.end() == prs.find(m->from())) {
+    return Raft::ErrStepPeerNotFound;
+  }
+
+  return raft_->Step(std::move(m));
+}
+
+size_t RawNode::StepBatch(Raft::Messages* msgs) {
+  size_t refused = 0;
+
+  const auto& prs = raft_->Progresses();
+  for (auto& m : *msgs) {
+    if (IsLocalMsg(m->type()) ||
+        (IsResponseMsg(m->type()) && prs.end() == prs.find(m->from()))) {
+      m.reset(nullptr);
+      refused++;
+    }
+  }
+  if (refused > 0) {
+    msgs->erase(std::remove(msgs->begin(), msgs->end(), nullptr), msgs->end());
+  }
+
+  return refused + raft_->StepBatch(msgs);
+}
+
+void RawNode::ReadIndex(const std::string& ctx) {
+  std::unique_ptr<raftpb::Message> m(new raftpb::Message);
+  m->set_type(raftpb::MsgReadIndex);
+  m->add_entries()->set_data(ctx);
+  raft_->Step(std::move(m));
+}
+
+void RawNode::TransferLeader(uint64_t transferee) {
+  std::unique_ptr<raftpb::Message> m(new raftpb::Message);
+  m->set_type(raftpb::MsgTransferLeader);
+  m->set_from(transferee);
+  raft_->Step(std::move(m));
+}
+
+void RawNode::ApplyConfChange(const raftpb::ConfChange& cc, raftpb::ConfState* cs) {
+  if (kNone != cc.nodeid()) {
+    switch (cc.type()) {
+      case raftpb::ConfChangeAddNode:
+        raft_->AddNode(cc.nodeid());
+        break;
+      case raftpb::ConfChangeAddLearnerNode:
+        raft_->AddLearner(cc.nodeid());
+        break;
+      case raftpb::ConfChangeRemoveNode:
+        raft_->RemoveNode(cc.nodeid());
+        break;
+      case raftpb::ConfChangeUpdateNode:
+        break;
+      default:
+        //Panicf, unexpected conf type
+        break;
+    }
+  }
+
+  cs->Clear();
+  for (const auto& pr : raft_->Progresses()) {
+    if (pr.second.IsLearner()) {
+      cs->add_learners(pr.first);
+    } else {
+      cs->add_nodes(pr.first);
+    }
+  }
+}
+
+void RawNode::ReportUnreachable(uint64_t id) {
+  std::unique_ptr<raftpb::Message> m(new raftpb::Message);
+  m->set_type(raftpb::MsgUnreachable);
+  m->set_from(id);
+  raft_->Step(std::move(m));
+}
+
+void RawNode::ReportSnapshot(uint64_t id, bool failure) {
+  std::unique_ptr<raftpb::Message> m(new raftpb::Message);
+  m->set_type(raftpb::MsgSnapStatus);
+  m->set_from(id);
+  m->set_reject(failure);
+  raft_->Step(std::move(m));
+}
+
+bool RawNode::HasReady() const {
+  RaftLog* raft_log = raft_->Log();
+
+  raftpb::Snapshot snapshot;
+  return SoftStateChanged() ||
+         HardStateChanged() ||
+         raft_log->UnstableSnapshot(&snapshot) ||
+         raft_log->HasUnstableEntries() ||
+         raft_->HasMessages() ||
+         raft_log->HasNextEntries() ||
+         raft_->HasReadStates();
+}
+
+void RawNode::GetReady(Ready* rd) {
+  rd->Clear();
+  RaftLog* raft_log = raft_->Log();
+
+  raft_log->UnstableEntries(&rd->entries);
+  raft_log->NextEntries(&rd->committed_entries);
+  raft_->TakeMessages(&rd->messages, &rd->messages_after_append);
+  raft_->TakeReadStates(&rd->read_states);
+
+  if (SoftStateChanged()) {
+    rd->soft_state.reset(new SoftState(raft_->GetSoftState()));
+    prev_soft_state_ = *rd->soft_state;
+  }
+  if (HardStateChanged()) {
+    rd->hard_state = raft_->GetHardState();
+  }
+  raft_log->UnstableSnapshot(&rd->snapshot);
+
+  // a change of commit alone does not need an fsync, losing it is harmless.
+  raftpb::HardState hard_state = raft_->GetHardState();
+  rd->must_sync = rd->entries.size() > 0 ||
+                  hard_state.term() != prev_hard_state_.term() ||
+                  hard_state.vote() != prev_hard_state_.vote();
+}
+
+void RawNode::Advance(const Ready& rd) {
+  RaftLog* raft_log = raft_->Log();
+
+  if (!IsHardStateEmpty(rd.hard_state)) {
+    prev_hard_state_ = rd.hard_state;
+  }
+
+  if (rd.entries.size() > 0) {
+    const raftpb::Entry& last = rd.entries.Get(rd.entries.size() - 1);
+    raft_->StableTo(last.index(), last.term());
+  }
+  if (0 != rd.snapshot.metadata().index()) {
+    raft_log->StableSnapTo(rd.snapshot.metadata().index());
+  }
+  if (rd.committed_entries.size() > 0) {
+    raft_log->ApplyTo(rd.committed_entries.Get(rd.committed_entries.size() - 1).index());
+  }
+}
+
+bool RawNode::SoftStateChanged() const {
+  SoftState soft_state = raft_->GetSoftState();
+  return soft_state.lead != prev_soft_state_.lead ||
+         soft_state.raft_state != prev_soft_state_.raft_state;
+}
+
+bool RawNode::HardStateChanged() const {
+  raftpb::HardState hard_state = raft_->GetHardState();
+  return hard_state.term() != prev_hard_state_.term() ||
+         hard_state.vote() != prev_hard_state_.vote() ||
+         hard_state.commit() != prev_hard_state_.commit();
+}
+
+bool RawNode::IsLocalMsg(raftpb::MessageType type) {
+  return raftpb::MsgHup == type || raftpb::MsgBeat == type ||
+         raftpb::MsgUnreachable == type || raftpb::MsgSnapStatus == type ||
+         raftpb::MsgCheckQuorum == type;
+}
+
+bool RawNode::IsResponseMsg(raftpb::MessageType type) {
+  return raftpb::MsgAppResp == type || raftpb::MsgVoteResp == type ||
+         raftpb::MsgHeartbeatResp == type || raftpb::MsgUnreachable == type ||
+         raftpb::MsgPreVoteResp == type;
+}
+
+} // namespace myraft
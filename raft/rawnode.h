@@ -0,0 +1,99 @@
+#ifndef MYRAFT_RAWNODE_H_
+#define MYRAFT_RAWNODE_H_
+
+#include <stdint.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "raft.h"
+#include "apply_wait.h"
+#include "raftpb/raft.pb.h"
+
+namespace myraft {
+
+// Ready is all the work the state machine produced since the last Advance:
+// entries and HardState to persist (in one write, synced iff must_sync),
+// committed entries to apply, messages to send and read states to serve.
+// messages may be sent while the write is in progress, messages_after_append
+// only once it completed.
+struct Ready {
+  using Entries = ::google::protobuf::RepeatedPtrField<::raftpb::Entry>;
+
+  // nullptr if unchanged.
+  std::unique_ptr<SoftState> soft_state;
+  // empty if unchanged.
+  raftpb::HardState          hard_state;
+  std::vector<ReadState>     read_states;
+  Entries                    entries;
+  // empty if there is no snapshot to persist.
+  raftpb::Snapshot           snapshot;
+  Entries                    committed_entries;
+  Raft::Messages             messages;
+  Raft::Messages             messages_after_append;
+  bool                       must_sync;
+
+  void Clear();
+}; // struct Ready
+
+// RawNode is a thread-unsafe wrapper of Raft that hands work to the
+// application in batches through GetReady and Advance. The application
+// sends Ready::messages and persists Ready::entries, Ready::hard_state and
+// Ready::snapshot in parallel, then sends Ready::messages_after_append,
+// applies Ready::committed_entries and calls Advance.
+class RawNode {
+ public:
+  using Error = Raft::Error;
+
+ public:
+  RawNode(const Config& config);
+  ~RawNode() = default;
+
+  RawNode(const RawNode&)            = delete;
+  RawNode& operator=(const RawNode&) = delete;
+  RawNode(RawNode&&)                 = delete;
+  RawNode& operator=(RawNode&&)      = delete;
+
+  void Tick();
+  Error Campaign();
+  Error Propose(const std::string& data);
+  Error ProposeConfChange(const raftpb::ConfChange& cc);
+  // steps a message from the network, local messages are refused.
+  Error Step(std::unique_ptr<raftpb::Message> m);
+  size_t StepBatch(Raft::Messages* msgs);
+  void ReadIndex(const std::string& ctx);
+  void TransferLeader(uint64_t transferee);
+  void ApplyConfChange(const raftpb::ConfChange& cc, raftpb::ConfState* cs);
+
+  void ReportUnreachable(uint64_t id);
+  void ReportSnapshot(uint64_t id, bool failure);
+
+  bool HasReady() const;
+  // moves everything accumulated since the last Advance into rd.
+  void GetReady(Ready* rd);
+  // acknowledges that everything in rd has been persisted and applied.
+  void Advance(const Ready& rd);
+
+  // callback runs once the applied index reaches index, see ApplyWait.
+  void WaitApplied(uint64_t index, ApplyWait::Callback callback)
+  { raft_->Log()->WaitApplied(index, std::move(callback)); }
+
+  Raft* GetRaft() { return raft_.get(); }
+
+ private:
+  bool SoftStateChanged() const;
+  bool HardStateChanged() const;
+
+  static bool IsLocalMsg(raftpb::MessageType type);
+  static bool IsResponseMsg(raftpb::MessageType type);
+
+ private:
+  std::unique_ptr<Raft> raft_;
+  SoftState             prev_soft_state_;
+  raftpb::HardState     prev_hard_state_;
+}; // class RawNode
+
+} // namespace myraft
+
+#endif // MYRAFT_RAWNODE_H_
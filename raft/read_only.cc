@@ -1,71 +1,195 @@
 #include "read_only.h"
 
+#include <stdlib.h>
+
+#include <algorithm>
 #include <utility>
 
+#include <util/coding.h>
+
 namespace myraft {
 
-ReadOnly::ReadOnly(ReadOnlyOption read_option)
-    : kReadOption(read_option) {}
+static const uint64_t kInitialRingSize = 16;
+
+ReadOnly::ReadOnly(ReadOnlyOption read_option, uint64_t self,
+                   uint64_t election_timeout, uint64_t max_clock_drift)
+    : kReadOption(read_option),
+      kSelf(self),
+      lease_(self, election_timeout > max_clock_drift ? election_timeout - max_clock_drift : 0),
+      ring_(kInitialRingSize),
+      mask_(kInitialRingSize - 1),
+      first_seq_(1),
+      release_seq_(1),
+      next_seq_(1),
+      open_(false),
+      revoked_(false),
+      pending_requests_(0) {
+  lease_.AddVoter(kSelf);
+}
 
-void ReadOnly::AddRequest(uint64_t index, std::unique_ptr<raftpb::Message> msg) {
-  std::string ctx = msg->entries(0).data();
-  if (pending_readindex_.end() != pending_readindex_.find(ctx)) {
-    return ;
+void ReadOnly::SetVoters(const std::vector<uint64_t>& voters) {
+  if (voters.size() > kMaxVoters) {
+    //Panicf, too many voters for the ack bitset
+    // a slot past the bitset width would be an undefined shift.
+    abort();
   }
 
-  auto& rs = pending_readindex_[ctx];
-  rs->request = std::move(msg);
-  rs->index = index;
+  for (uint64_t voter : voters_) {
+    lease_.RemoveVoter(voter);
+  }
+  voters_ = voters;
+  for (uint64_t voter : voters_) {
+    lease_.AddVoter(voter);
+  }
 
-  readindex_queue_.push_back(std::move(ctx));
+  // slots are reassigned, so acks collected so far can not be trusted.
+  for (uint64_t seq = first_seq_; seq < next_seq_; seq++) {
+    ring_[seq & mask_].acks = 0;
+  }
 }
 
-uint32_t ReadOnly::RecvAck(const std::unique_ptr<const raftpb::Message>& msg) {
-  auto rs = pending_readindex_.find(msg->context());
-  if (pending_readindex_.end() == rs) {
-    return 0;
+void ReadOnly::AddRequest(uint64_t index, std::unique_ptr<raftpb::Message> msg) {
+  if (!open_) {
+    if (next_seq_ - first_seq_ == ring_.size()) {
+      Grow();
+    }
+
+    ReadIndexStatus& rs = ring_[next_seq_ & mask_];
+    rs.requests.clear();
+    rs.seq   = next_seq_;
+    rs.index = index;
+    rs.send_time = 0;
+    rs.acks  = 0;
+    open_ = true;
   }
 
-  rs->second->acks.insert(msg->from());
-  return rs->second->acks.size() + 1;
+  // committed index only grows, so the batch index is not less than the
+  // committed index any of its requests arrived at.
+  ReadIndexStatus& rs = ring_[next_seq_ & mask_];
+  rs.index = std::max(rs.index, index);
+  rs.requests.push_back(std::move(msg));
+  pending_requests_++;
 }
 
-std::vector<std::unique_ptr<ReadOnly::ReadIndexStatus>> ReadOnly::Advance(
-    const std::unique_ptr<const raftpb::Message>& msg) {
-  const std::string ctx = msg->context();
+std::string ReadOnly::SealBatch(uint64_t now) {
+  Trim(now);
+  if (!open_) {
+    if (!Leasing()) {
+      return "";
+    }
 
-  int count = 0;
-  bool found = false;
-  for (auto iter = readindex_queue_.begin(); readindex_queue_.end() != iter; iter++) {
-    count++;
-    if (pending_readindex_.end() == pending_readindex_.find(*iter)) {
-      //panic
+    if (next_seq_ - first_seq_ == ring_.size()) {
+      Grow();
     }
 
-    if (ctx == *iter) {
-      found = true;
+    ReadIndexStatus& rs = ring_[next_seq_ & mask_];
+    rs.requests.clear();
+    rs.seq   = next_seq_;
+    rs.index = 0;
+    rs.acks  = 0;
+  }
+
+  ring_[next_seq_ & mask_].send_time = now;
+  open_ = false;
+  return EncodeContext(next_seq_++);
+}
+
+uint32_t ReadOnly::RecvAck(const std::unique_ptr<const raftpb::Message>& msg) {
+  ReadIndexStatus* rs = Find(DecodeContext(msg->context()));
+  if (nullptr == rs) {
+    return 0;
+  }
+
+  for (size_t slot = 0; slot < voters_.size(); slot++) {
+    if (msg->from() == voters_[slot]) {
+      rs->acks |= static_cast<AckSet>(1) << slot;
+      // the follower was active when the round was sent, not just when the
+      // ack arrived, which keeps the lease on the safe side of the delay.
+      if (Leasing()) {
+        lease_.RecordActive(msg->from(), rs->send_time);
+      }
       break;
     }
   }
 
-  std::vector<std::unique_ptr<ReadIndexStatus>> rss;
-  if (found) {
-    for (int i = 0; i < count; i++) {
-      rss.push_back(std::move(pending_readindex_[readindex_queue_.front()]));
-      pending_readindex_.erase(readindex_queue_.front());
-      readindex_queue_.pop_front();
+  return __builtin_popcountll(rs->acks) + 1;
+}
+
+size_t ReadOnly::Advance(const std::unique_ptr<const raftpb::Message>& msg,
+                         std::vector<ReadRequest>* released) {
+  uint64_t seq = DecodeContext(msg->context());
+  if (seq < release_seq_ || seq >= next_seq_) {
+    return 0;
+  }
+
+  size_t count = 0;
+  for (; release_seq_ <= seq; release_seq_++) {
+    ReadIndexStatus& rs = ring_[release_seq_ & mask_];
+    for (auto& request : rs.requests) {
+      released->push_back(ReadRequest{rs.index, std::move(request)});
     }
+    count += rs.requests.size();
+    rs.requests.clear();
+  }
+  if (!Leasing()) {
+    first_seq_ = release_seq_;
   }
 
-  return std::move(rss);
+  pending_requests_ -= count;
+  return count;
 }
 
 std::string ReadOnly::LastPendingRequestCtx() {
-  if (0 == readindex_queue_.size()) {
+  if (release_seq_ == next_seq_) {
     return "";
   }
 
-  return readindex_queue_.back();
+  return EncodeContext(next_seq_ - 1);
+}
+
+std::string ReadOnly::EncodeContext(uint64_t seq) {
+  std::string ctx;
+  myutil::PutFixed64(&ctx, seq);
+  return ctx;
+}
+
+uint64_t ReadOnly::DecodeContext(const std::string& ctx) {
+  if (sizeof(uint64_t) != ctx.size()) {
+    return 0;
+  }
+
+  return myutil::DecodeFixed64(ctx.data());
+}
+
+ReadOnly::ReadIndexStatus* ReadOnly::Find(uint64_t seq) {
+  if (seq < first_seq_ || seq >= next_seq_) {
+    return nullptr;
+  }
+
+  return &ring_[seq & mask_];
+}
+
+void ReadOnly::Trim(uint64_t now) {
+  // an ack of a round sent a lease duration ago can not extend the lease past
+  // now, and a round every voter acked has nothing more to record.
+  for (; first_seq_ < release_seq_; first_seq_++) {
+    const ReadIndexStatus& rs = ring_[first_seq_ & mask_];
+    if (rs.send_time + lease_.LeaseDuration() > now &&
+        static_cast<size_t>(__builtin_popcountll(rs.acks)) < voters_.size()) {
+      break;
+    }
+  }
+}
+
+void ReadOnly::Grow() {
+  std::vector<ReadIndexStatus> ring(ring_.size() * 2);
+  uint64_t mask = ring.size() - 1;
+  for (uint64_t seq = first_seq_; seq < next_seq_; seq++) {
+    ring[seq & mask] = std::move(ring_[seq & mask_]);
+  }
+
+  ring_.swap(ring);
+  mask_ = mask;
 }
 
 }; // namspace myraft
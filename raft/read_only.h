@@ -6,10 +6,8 @@
 #include <string>
 #include <memory>
 #include <vector>
-#include <deque>
-#include <set>
-#include <unordered_map>
 
+#include "lease_tracker.h"
 #include "raftpb/raft.pb.h"
 
 namespace myraft {
@@ -21,14 +19,31 @@ class ReadOnly {
     ReadOnlyLeaseBased,
   }; // enum ReadOnlyOption
 
+  // one bit per voter slot, see SetVoters.
+  using AckSet = uint64_t;
+  static const size_t kMaxVoters = 64;
+
+  // all the requests of a batch share one read index and one heartbeat round,
+  // identified by a monotonically increasing sequence number.
   struct ReadIndexStatus {
-    std::unique_ptr<raftpb::Message> request;
+    std::vector<std::unique_ptr<raftpb::Message>> requests;
+    uint64_t                    seq;
     uint64_t                    index;
-    std::set<uint64_t>          acks;
+    uint64_t                    send_time;
+    AckSet                      acks;
   }; // struct ReadIndexStatus
 
+  struct ReadRequest {
+    uint64_t                         index;
+    std::unique_ptr<raftpb::Message> request;
+  }; // struct ReadRequest
+
  public:
-  ReadOnly(ReadOnlyOption read_option);
+  // election_timeout and max_clock_drift are in microseconds and only used by
+  // ReadOnlyLeaseBased, whose lease lasts election_timeout - max_clock_drift
+  // from the moment a quorum acknowledged heartbeat round was sent.
+  ReadOnly(ReadOnlyOption read_option, uint64_t self = 0,
+           uint64_t election_timeout = 0, uint64_t max_clock_drift = 0);
   ~ReadOnly() = default;
 
   ReadOnly(const ReadOnly&)            = delete;
@@ -36,15 +51,67 @@ class ReadOnly {
   ReadOnly(ReadOnly&&)                 = default;
   ReadOnly& operator=(ReadOnly&&)      = default;
 
+  ReadOnlyOption Option() const { return kReadOption; }
+
+  // voters other than the leader itself, acks from anyone else are ignored.
+  // Aborts on more than kMaxVoters.
+  void SetVoters(const std::vector<uint64_t>& voters);
+
+  // adds the request to the open batch, index is the committed index at arrival.
   void AddRequest(uint64_t index, std::unique_ptr<raftpb::Message> msg);
+  bool HasOpenBatch() const { return open_; }
+  // closes the open batch and returns the context its heartbeat round carries,
+  // now is the monotonic time the round is sent at. With ReadOnlyLeaseBased an
+  // empty round is started if there is no open batch, so that every heartbeat
+  // renews the lease.
+  std::string SealBatch(uint64_t now);
+
+  // true iff reads can be served locally without a heartbeat round.
+  bool LeaseValid(uint64_t now) const { return Leasing() && lease_.LeaseValid(now); }
+  // the lease is neither served nor renewed any more, reads take a heartbeat
+  // round as with ReadOnlySafe. Used once a leader transfer starts, the
+  // transferee campaigns without waiting for the lease to run out.
+  void RevokeLease() { revoked_ = true; }
+  bool Leasing() const { return ReadOnlyLeaseBased == kReadOption && !revoked_; }
+  uint64_t LeaseValidUntil() const { return lease_.LeaseValidUntil(); }
+
+  // returns the number of acks including the leader, 0 if the round is unknown.
+  // With ReadOnlyLeaseBased the acks of a released round still renew the
+  // lease, so every voter's activity counts and not only the fastest quorum's.
   uint32_t RecvAck(const std::unique_ptr<const raftpb::Message>& msg);
-  std::vector<std::unique_ptr<ReadIndexStatus>> Advance(const std::unique_ptr<const raftpb::Message>& msg);
+  // releases every request up to and including the round msg acknowledges,
+  // rounds already released are ignored.
+  size_t Advance(const std::unique_ptr<const raftpb::Message>& msg,
+                 std::vector<ReadRequest>* released);
   std::string LastPendingRequestCtx();
 
+  size_t PendingRequests() const { return pending_requests_; }
+
+  static std::string EncodeContext(uint64_t seq);
+  static uint64_t DecodeContext(const std::string& ctx);
+
+ private:
+  ReadIndexStatus* Find(uint64_t seq);
+  void Grow();
+  // forgets released rounds no late ack can renew the lease with any more.
+  void Trim(uint64_t now);
+
  private:
-  const ReadOnlyOption    kReadOption;
-  std::deque<std::string> readindex_queue_;
-  std::unordered_map<std::string, std::unique_ptr<ReadIndexStatus>> pending_readindex_;
+  const ReadOnlyOption         kReadOption;
+  const uint64_t               kSelf;
+  std::vector<uint64_t>        voters_;
+  LeaseTracker                 lease_;
+  // ring buffer holding the statuses of rounds [first_seq_, next_seq_), the
+  // open batch, if any, lives at next_seq_. Rounds before release_seq_ are
+  // released and only kept for the late acks of ReadOnlyLeaseBased.
+  std::vector<ReadIndexStatus> ring_;
+  uint64_t                     mask_;
+  uint64_t                     first_seq_;
+  uint64_t                     release_seq_;
+  uint64_t                     next_seq_;
+  bool                         open_;
+  bool                         revoked_;
+  size_t                       pending_requests_;
 }; // class ReadOnly
 
 } // namespace myraft
@@ -9,6 +9,9 @@
 
 namespace myraft {
 
+// a max_size that lets every entry through.
+static const uint64_t kNoLimit = UINT64_MAX;
+
 class Storage {
  private:
   using Entries = ::google::protobuf::RepeatedPtrField<::raftpb::Entry>;
@@ -43,13 +46,16 @@ class Storage {
   Storage(Storage&&)                 = default;
   Storage& operator=(Storage&&)      = default;
 
-  virtual Error InitialState(raftpb::HardState* hard_state, raftpb::ConfState* conf_state) const;
-  virtual Error GetEntries(uint64_t low, uint64_t high, Entries* entries) const;
+  virtual Error InitialState(raftpb::HardState* hard_state, raftpb::ConfState* conf_state) const = 0;
+  // the entries in [low, high) as long as their total ByteSizeLong stays
+  // within max_size, the first one is returned regardless.
+  virtual Error GetEntries(uint64_t low, uint64_t high, uint64_t max_size,
+                           Entries* entries) const = 0;
   //append 语义
-  virtual Error Term(uint64_t index, uint64_t* result) const;
-  virtual Error LastIndex(uint64_t* result) const;
-  virtual Error FirstIndex(uint64_t* result) const;
-  virtual Error Snapshot(raftpb::Snapshot* snapshot) const;
+  virtual Error Term(uint64_t index, uint64_t* result) const = 0;
+  virtual Error LastIndex(uint64_t* result) const = 0;
+  virtual Error FirstIndex(uint64_t* result) const = 0;
+  virtual Error Snapshot(raftpb::Snapshot* snapshot) const = 0;
 }; // class Storage
 
 } // namespace myraft
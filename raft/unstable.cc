@@ -92,13 +92,18 @@ void Unstable::TruncateAndAppend(const EntrySlice& entries) {
   }
 }
 
-void Unstable::Slice(uint64_t low, uint64_t high, Entries* entries) {
+void Unstable::Slice(uint64_t low, uint64_t high, Entries* entries, uint64_t max_size) {
   MustCheckOutofBounds(low, high);
+  uint64_t size = 0;
   for (uint64_t i = low; i < high; ) {
     uint64_t base = BaseIndex(i);
     std::unique_ptr<raftpb::Entry[]>& buffer = entries_[base];
 
     for (uint64_t j = i - base; j < kEntryBufferSize && i < high; j++, i++) {
+      size += buffer[j].ByteSizeLong();
+      if (size > max_size && !entries->empty()) {
+        return ;
+      }
       *(entries->Add()) = buffer[j];
     }
   }
@@ -6,6 +6,7 @@
 #include <memory>
 
 #include "entry_slice.h"
+#include "storage.h"
 #include "raftpb/raft.pb.h"
 
 namespace myraft {
@@ -35,7 +36,9 @@ class Unstable {
   void Restore(const raftpb::Snapshot& snapshot);
   void TruncateAndAppend(const EntrySlice& entries);
 
-  void Slice(uint64_t low, uint64_t high, Entries* entries);
+  // appends [low, high) to entries while they fit in max_size bytes, an
+  // entry appended to empty entries always fits.
+  void Slice(uint64_t low, uint64_t high, Entries* entries, uint64_t max_size = kNoLimit);
 
   uint64_t First() const { return first_; }
   uint64_t Last()  const { return last_; }
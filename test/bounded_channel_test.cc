@@ -0,0 +1,121 @@
+// g++ -std=c++11 -I. -Iutil test/bounded_channel_test.cc util/util.cc -lpthread -o bounded_channel_test
+
+#include <assert.h>
+#include <stdio.h>
+#include <unistd.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <transport/bounded_channel.h>
+#include <util/util.h>
+
+using namespace myutil;
+
+static std::vector<int> ReadAll(BoundedChannel<int>* channel, size_t max = 100) {
+  std::vector<int> values;
+  std::unique_ptr<Queue<int>> queue = channel->Read(max);
+  while (!queue->Empty()) {
+    values.push_back(queue->Pop());
+  }
+  return values;
+}
+
+static void TestFull() {
+  auto channel = MakeBoundedChannel<int>(2);
+  assert(channel->TryWrite(1));
+  assert(channel->TryWrite(2));
+  assert(!channel->TryWrite(3));
+  assert(2 == channel->Size());
+
+  // a failed write leaves the value alone.
+  std::string value("kept");
+  auto strings = MakeBoundedChannel<std::string>(1);
+  assert(strings->TryWrite(std::string("first")));
+  assert(!strings->TryWrite(std::move(value)));
+  assert("kept" == value);
+
+  assert((std::vector<int>{1}) == ReadAll(channel.get(), 1));
+  assert(channel->TryWrite(3));
+  assert((std::vector<int>{2, 3}) == ReadAll(channel.get()));
+}
+
+static void TestTimeout() {
+  auto channel = MakeBoundedChannel<int>(1);
+  assert(channel->Write(1, 1000));
+
+  uint64_t start = MonotonicMicros();
+  assert(!channel->Write(2, 20000));
+  assert(MonotonicMicros() - start >= 20000);
+
+  // a read makes room for a waiting writer.
+  std::thread reader([&channel] {
+    usleep(20000);
+    ReadAll(channel.get());
+  });
+  assert(channel->Write(2, 5000000));
+  reader.join();
+  assert((std::vector<int>{2}) == ReadAll(channel.get()));
+}
+
+static void TestClose() {
+  auto channel = MakeBoundedChannel<int>(1);
+  assert(channel->TryWrite(1));
+
+  // a blocked writer gives up.
+  std::thread closer([&channel] {
+    usleep(20000);
+    channel->Close();
+  });
+  uint64_t start = MonotonicMicros();
+  assert(!channel->Write(2, 5000000));
+  assert(MonotonicMicros() - start < 5000000);
+  closer.join();
+
+  // later writes fail, what was written can still be read.
+  assert(!channel->TryWrite(3));
+  assert(!channel->Write(3, 1000));
+  assert((std::vector<int>{1}) == ReadAll(channel.get()));
+}
+
+static void TestWatermarks() {
+  auto channel = MakeBoundedChannel<int>(10);
+  std::string calls;
+  channel->SetWatermarks(4, 1, [&calls] { calls += "h"; }, [&calls] { calls += "l"; });
+
+  for (int i = 0; i < 3; i++) {
+    assert(channel->TryWrite(i));
+  }
+  assert(calls.empty());
+  // high once, however far the channel fills.
+  assert(channel->TryWrite(3));
+  assert("h" == calls);
+  assert(channel->TryWrite(4));
+  assert("h" == calls);
+
+  // not low until the size is down to low.
+  ReadAll(channel.get(), 3);
+  assert("h" == calls);
+  ReadAll(channel.get(), 1);
+  assert("hl" == calls);
+  ReadAll(channel.get());
+  assert("hl" == calls);
+
+  // below high again, they keep alternating.
+  for (int i = 0; i < 4; i++) {
+    assert(channel->TryWrite(i));
+  }
+  assert("hlh" == calls);
+  ReadAll(channel.get());
+  assert("hlhl" == calls);
+}
+
+int main() {
+  TestFull();
+  TestTimeout();
+  TestClose();
+  TestWatermarks();
+  printf("ok\n");
+  return 0;
+}
@@ -0,0 +1,65 @@
+// g++ -std=c++11 -I. -Iutil test/event_loop_test.cc transport/event_loop.cc util/*.cc -lpthread -o event_loop_test
+
+#include <assert.h>
+#include <stdio.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include <transport/event_loop.h>
+
+// two fds are ready in one batch. Whichever callback runs first closes the
+// other fd and registers a new one that gets the same number, the pending
+// event of the old fd must not reach the new callback.
+static void TestReusedFd() {
+  auto loop = myutil::MakeEventLoop();
+  int fds[2] = {eventfd(1, EFD_NONBLOCK), eventfd(1, EFD_NONBLOCK)};
+  int first = -1;
+  int stale = 0;
+
+  for (int i = 0; i < 2; i++) {
+    int self  = fds[i];
+    int other = fds[1 - i];
+    loop->Add(self, EPOLLIN, [&, self, other](uint32_t) {
+      if (-1 != first) {
+        return ;
+      }
+      first = self;
+      loop->Remove(other);
+      close(other);
+
+      int reused = eventfd(0, EFD_NONBLOCK);
+      assert(reused == other);
+      loop->Add(reused, EPOLLIN, [&stale](uint32_t) { stale++; });
+    });
+  }
+
+  assert(1 <= loop->RunOnce(100));
+  assert(-1 != first);
+  assert(0 == stale);
+}
+
+static void TestRemoveInBatch() {
+  auto loop = myutil::MakeEventLoop();
+  int fds[2] = {eventfd(1, EFD_NONBLOCK), eventfd(1, EFD_NONBLOCK)};
+  int calls = 0;
+
+  for (int i = 0; i < 2; i++) {
+    int other = fds[1 - i];
+    loop->Add(fds[i], EPOLLIN, [&, other](uint32_t) {
+      calls++;
+      loop->Remove(other);
+    });
+  }
+
+  loop->RunOnce(100);
+  assert(1 == calls);
+  close(fds[0]);
+  close(fds[1]);
+}
+
+int main() {
+  TestReusedFd();
+  TestRemoveInBatch();
+  printf("ok\n");
+  return 0;
+}
@@ -0,0 +1,122 @@
+// g++ -std=c++11 -I. -Iutil -Iraft test/heartbeat_coalescer_test.cc raft/*.cc raft/raftpb/raft.pb.cc util/*.cc -lprotobuf -lpthread -lz -o heartbeat_coalescer_test
+
+#include <assert.h>
+#include <stdio.h>
+#include <unistd.h>
+
+#include <string>
+#include <vector>
+
+#include "heartbeat_coalescer.h"
+#include "test_cluster.h"
+
+using namespace myraft;
+
+static const uint64_t kGroupId = 1;
+
+static std::unique_ptr<raftpb::Message> Heartbeat(uint64_t to, const std::string& ctx) {
+  std::unique_ptr<raftpb::Message> m(new raftpb::Message);
+  m->set_type(raftpb::MsgHeartbeat);
+  m->set_from(1);
+  m->set_to(to);
+  m->set_term(3);
+  m->set_commit(7);
+  m->set_context(ctx);
+  return m;
+}
+
+static void TestExtractContext() {
+  HeartbeatCoalescer coalescer(1);
+  Raft::Messages msgs;
+  msgs.push_back(Heartbeat(2, ""));
+  msgs.push_back(Heartbeat(3, "round"));
+
+  // a heartbeat with a context is left alone unless asked for.
+  coalescer.Extract(kGroupId, &msgs);
+  assert(1 == msgs.size() && "round" == msgs[0]->context());
+  coalescer.Extract(kGroupId, &msgs, true);
+  assert(msgs.empty());
+
+  std::vector<raftpb::HeartbeatBatch> batches;
+  coalescer.Flush(&batches);
+  assert(2 == batches.size());
+  for (const auto& batch : batches) {
+    HeartbeatCoalescer::GroupMessages expanded;
+    std::vector<raftpb::GroupHeartbeat> quiesces;
+    HeartbeatCoalescer::Expand(batch, &expanded, &quiesces);
+    assert(1 == expanded.size() && quiesces.empty());
+    const raftpb::Message& m = *expanded[0].second;
+    assert(kGroupId == expanded[0].first);
+    assert(raftpb::MsgHeartbeat == m.type() && batch.to() == m.to());
+    assert(3 == m.term() && 7 == m.commit());
+    assert((3 == m.to() ? "round" : "") == m.context());
+  }
+}
+
+// moves the heartbeats on the wire through one coalescer per node, the way
+// MultiRaft sends them, and steps what comes out.
+static void Coalesce(Cluster* cluster) {
+  std::map<uint64_t, Raft::Messages> outgoing;
+  for (auto& m : cluster->Wire()) {
+    uint64_t from = m->from();
+    outgoing[from].push_back(std::move(m));
+  }
+  cluster->Wire().clear();
+
+  std::vector<raftpb::HeartbeatBatch> batches;
+  for (auto& out : outgoing) {
+    HeartbeatCoalescer coalescer(out.first);
+    coalescer.Extract(kGroupId, &out.second, true);
+    assert(out.second.empty());
+    coalescer.Flush(&batches);
+  }
+
+  for (const auto& batch : batches) {
+    HeartbeatCoalescer::GroupMessages msgs;
+    std::vector<raftpb::GroupHeartbeat> quiesces;
+    HeartbeatCoalescer::Expand(batch, &msgs, &quiesces);
+    for (auto& m : msgs) {
+      cluster->Node(batch.to())->Step(std::move(m.second));
+    }
+  }
+}
+
+// the heartbeats of a lease carry the round they seal, coalesced acks have
+// to renew the lease all the same.
+static void TestCoalescedLease() {
+  // a lease of 9 ticks of 20ms.
+  Cluster cluster(ReadOnly::ReadOnlyLeaseBased, 20000);
+  cluster.Node(1)->Campaign();
+  cluster.Stabilize();
+  assert(StateLeader == cluster.Node(1)->GetRaft()->State());
+
+  // let the lease of the election run out.
+  usleep(250000);
+  cluster.Node(1)->ReadIndex("a");
+  cluster.Ready(1);
+  assert(cluster.Reads(1).empty());
+  cluster.Stabilize();
+  assert(1 == cluster.Reads(1).size());
+  usleep(250000);
+
+  cluster.Node(1)->Tick();
+  cluster.Ready(1);
+  assert(cluster.OnWire(raftpb::MsgHeartbeat));
+  Coalesce(&cluster);
+  cluster.Ready(2);
+  cluster.Ready(3);
+  assert(cluster.OnWire(raftpb::MsgHeartbeatResp));
+  Coalesce(&cluster);
+
+  cluster.Node(1)->ReadIndex("b");
+  cluster.Ready(1);
+  assert(2 == cluster.Reads(1).size() && "b" == cluster.Reads(1)[1]);
+  assert(!cluster.OnWire(raftpb::MsgHeartbeat));
+}
+
+int main() {
+  TestExtractContext();
+  TestCoalescedLease();
+  printf("ok\n");
+  return 0;
+}
@@ -0,0 +1,92 @@
+// g++ -std=c++11 -I. -Iutil -Iraft test/lease_read_test.cc raft/*.cc raft/raftpb/raft.pb.cc util/*.cc -lprotobuf -lpthread -lz -o lease_read_test
+
+#include <assert.h>
+#include <stdio.h>
+
+#include <string>
+
+#include "test_cluster.h"
+
+using namespace myraft;
+
+static bool IsTimeoutNow(const raftpb::Message& m) {
+  return raftpb::MsgTimeoutNow == m.type();
+}
+
+// elects node 1 and lets one heartbeat round renew its lease.
+static void ElectWithLease(Cluster* cluster) {
+  cluster->Node(1)->Campaign();
+  cluster->Stabilize();
+  assert(StateLeader == cluster->Node(1)->GetRaft()->State());
+
+  cluster->Node(1)->Tick();
+  cluster->Stabilize();
+}
+
+static void TestLeaseRead() {
+  Cluster cluster(ReadOnly::ReadOnlyLeaseBased);
+  ElectWithLease(&cluster);
+
+  // served at once, no heartbeat round.
+  cluster.Node(1)->ReadIndex("a");
+  cluster.Ready(1);
+  assert(1 == cluster.Reads(1).size() && "a" == cluster.Reads(1)[0]);
+  assert(!cluster.OnWire(raftpb::MsgHeartbeat));
+}
+
+// the transferee campaigns with kCampaignTransfer, which followers grant
+// within the old leader's lease, so the lease stops counting.
+static void TestTransferRevokesLease() {
+  Cluster cluster(ReadOnly::ReadOnlyLeaseBased);
+  ElectWithLease(&cluster);
+
+  cluster.Node(1)->TransferLeader(2);
+  cluster.Ready(1);
+  assert(cluster.OnWire(raftpb::MsgTimeoutNow));
+  // the transfer stalls, MsgTimeoutNow is lost.
+  cluster.Stabilize(IsTimeoutNow);
+
+  cluster.Node(1)->ReadIndex("b");
+  cluster.Ready(1);
+  assert(cluster.Reads(1).empty());
+  assert(cluster.OnWire(raftpb::MsgHeartbeat));
+  cluster.Stabilize(IsTimeoutNow);
+  assert(1 == cluster.Reads(1).size() && "b" == cluster.Reads(1)[0]);
+
+  // acks of later heartbeats do not bring it back, nor does the abort.
+  for (int i = 0; i < 10; i++) {
+    cluster.Node(1)->Tick();
+    cluster.Stabilize(IsTimeoutNow);
+  }
+  assert(StateLeader == cluster.Node(1)->GetRaft()->State());
+  cluster.Node(1)->ReadIndex("c");
+  cluster.Ready(1);
+  assert(1 == cluster.Reads(1).size());
+  cluster.Stabilize(IsTimeoutNow);
+  assert(2 == cluster.Reads(1).size() && "c" == cluster.Reads(1)[1]);
+}
+
+// a new term starts with a lease of its own.
+static void TestLeaseAfterTransfer() {
+  Cluster cluster(ReadOnly::ReadOnlyLeaseBased);
+  ElectWithLease(&cluster);
+
+  cluster.Node(1)->TransferLeader(2);
+  cluster.Stabilize();
+  assert(StateLeader == cluster.Node(2)->GetRaft()->State());
+  assert(StateFollower == cluster.Node(1)->GetRaft()->State());
+
+  cluster.Node(2)->Tick();
+  cluster.Stabilize();
+  cluster.Node(2)->ReadIndex("d");
+  cluster.Ready(2);
+  assert(1 == cluster.Reads(2).size() && "d" == cluster.Reads(2)[0]);
+}
+
+int main() {
+  TestLeaseRead();
+  TestTransferRevokesLease();
+  TestLeaseAfterTransfer();
+  printf("ok\n");
+  return 0;
+}
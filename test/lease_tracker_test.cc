@@ -0,0 +1,87 @@
+// g++ -std=c++11 -I. -Iraft test/lease_tracker_test.cc raft/lease_tracker.cc -o lease_tracker_test
+
+#include <assert.h>
+#include <stdio.h>
+
+#include "lease_tracker.h"
+
+using namespace myraft;
+
+static void TestQuorumActiveTime() {
+  LeaseTracker tracker(1, 100);
+  tracker.AddVoter(1);
+  tracker.AddVoter(2);
+  tracker.AddVoter(3);
+  tracker.AddVoter(4);
+  tracker.AddVoter(5);
+  assert(0 == tracker.QuorumActiveTime());
+  assert(!tracker.LeaseValid(0));
+
+  tracker.RecordActive(2, 10);
+  assert(0 == tracker.QuorumActiveTime());
+  tracker.RecordActive(3, 20);
+  assert(10 == tracker.QuorumActiveTime());
+  assert(110 == tracker.LeaseValidUntil());
+  assert(tracker.LeaseValid(109));
+  assert(!tracker.LeaseValid(110));
+
+  // older times are ignored.
+  tracker.RecordActive(2, 5);
+  assert(10 == tracker.QuorumActiveTime());
+
+  tracker.RecordActive(4, 30);
+  assert(20 == tracker.QuorumActiveTime());
+
+  tracker.Reset();
+  assert(0 == tracker.QuorumActiveTime());
+}
+
+// with a bare quorum acking, the voter being raised is the one setting the
+// quorum's time.
+static void TestBareQuorum() {
+  LeaseTracker tracker(1, 100);
+  tracker.AddVoter(1);
+  tracker.AddVoter(2);
+  tracker.AddVoter(3);
+
+  tracker.RecordActive(2, 5);
+  assert(5 == tracker.QuorumActiveTime());
+  tracker.RecordActive(2, 10);
+  assert(10 == tracker.QuorumActiveTime());
+  tracker.RecordActive(2, 1000);
+  assert(1000 == tracker.QuorumActiveTime());
+
+  // a voter at the quorum's time ties with another, raising one of them
+  // leaves the other setting it.
+  tracker.RecordActive(3, 1000);
+  tracker.RecordActive(3, 2000);
+  assert(2000 == tracker.QuorumActiveTime());
+  tracker.RecordActive(2, 1500);
+  assert(2000 == tracker.QuorumActiveTime());
+}
+
+static void TestMembershipChange() {
+  LeaseTracker tracker(1, 100);
+  tracker.AddVoter(1);
+  tracker.AddVoter(2);
+  tracker.AddVoter(3);
+  tracker.RecordActive(2, 50);
+  assert(50 == tracker.QuorumActiveTime());
+
+  // one more voter raises the quorum to three.
+  tracker.AddVoter(4);
+  assert(0 == tracker.QuorumActiveTime());
+  tracker.RecordActive(4, 40);
+  assert(40 == tracker.QuorumActiveTime());
+
+  tracker.RemoveVoter(4);
+  assert(50 == tracker.QuorumActiveTime());
+}
+
+int main() {
+  TestQuorumActiveTime();
+  TestBareQuorum();
+  TestMembershipChange();
+  printf("ok\n");
+  return 0;
+}
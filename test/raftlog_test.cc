@@ -0,0 +1,92 @@
+// g++ -std=c++11 -I. -Iutil -Iraft test/raftlog_test.cc raft/raftlog.cc raft/unstable.cc raft/apply_wait.cc raft/raftpb/raft.pb.cc -lprotobuf -lpthread -o raftlog_test
+
+#include <assert.h>
+#include <stdio.h>
+
+#include <memory>
+#include <string>
+
+#include <bench/mem_storage.h>
+
+#include "raftlog.h"
+
+using namespace myraft;
+
+using Entries = ::google::protobuf::RepeatedPtrField<::raftpb::Entry>;
+
+static Entries MakeEntries(uint64_t first, uint64_t last, size_t size) {
+  Entries entries;
+  for (uint64_t index = first; index <= last; index++) {
+    raftpb::Entry* entry = entries.Add();
+    entry->set_index(index);
+    entry->set_term(1);
+    entry->set_data(std::string(size, 'x'));
+  }
+  return entries;
+}
+
+// entries 1-5 in storage and 6-10 unstable, each of entry_size bytes.
+static std::unique_ptr<RaftLog> MakeLog(uint64_t* entry_size) {
+  Entries stable = MakeEntries(1, 5, 100);
+  *entry_size = stable.Get(0).ByteSizeLong();
+
+  std::shared_ptr<MemStorage> storage(new MemStorage);
+  storage->Append(stable);
+  std::unique_ptr<RaftLog> raft_log = NewRaftLog(storage);
+
+  Entries unstable = MakeEntries(6, 10, 100);
+  raft_log->Append(EntrySlice(unstable, 0, unstable.size()));
+  return raft_log;
+}
+
+static void TestGetEntriesMaxSize() {
+  uint64_t size = 0;
+  std::unique_ptr<RaftLog> raft_log = MakeLog(&size);
+
+  struct {
+    uint64_t index;
+    uint64_t max_size;
+    int      want;
+  } tests[] = {
+    // at least one entry, in storage or unstable.
+    {1, 0, 1},
+    {7, 0, 1},
+    {1, size - 1, 1},
+    {1, size, 1},
+    {1, size * 2, 2},
+    {1, size * 2 + 1, 2},
+    // across the storage and unstable boundary.
+    {4, size * 3, 3},
+    {5, size * 3, 3},
+    {1, size * 7, 7},
+    {1, kNoLimit, 10},
+    {9, kNoLimit, 2},
+    {11, 0, 0},
+  };
+  for (const auto& test : tests) {
+    Entries entries;
+    assert(Storage::OK == raft_log->GetEntries(test.index, test.max_size, &entries));
+    assert(test.want == entries.size());
+    for (int i = 0; i < entries.size(); i++) {
+      assert(test.index + i == entries.Get(i).index());
+    }
+  }
+}
+
+static void TestSlice() {
+  uint64_t size = 0;
+  std::unique_ptr<RaftLog> raft_log = MakeLog(&size);
+
+  Entries entries;
+  assert(Storage::OK == raft_log->Slice(3, 8, kNoLimit, &entries));
+  assert(5 == entries.size() && 3 == entries.Get(0).index() && 7 == entries.Get(4).index());
+  assert(Storage::OK == raft_log->Slice(3, 8, size * 2, &entries));
+  assert(2 == entries.size());
+}
+
+int main() {
+  TestGetEntriesMaxSize();
+  TestSlice();
+  printf("ok\n");
+  return 0;
+}
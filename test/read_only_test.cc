@@ -0,0 +1,130 @@
+// g++ -std=c++11 -I. -Iraft test/read_only_test.cc raft/read_only.cc raft/lease_tracker.cc raft/raftpb/raft.pb.cc -lprotobuf -lpthread -o read_only_test
+
+#include <assert.h>
+#include <stdio.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "read_only.h"
+
+using namespace myraft;
+
+static std::unique_ptr<const raftpb::Message> Ack(uint64_t from, const std::string& ctx) {
+  std::unique_ptr<raftpb::Message> m(new raftpb::Message);
+  m->set_type(raftpb::MsgHeartbeatResp);
+  m->set_from(from);
+  m->set_context(ctx);
+  return std::unique_ptr<const raftpb::Message>(m.release());
+}
+
+static std::unique_ptr<raftpb::Message> Request(uint64_t from) {
+  std::unique_ptr<raftpb::Message> m(new raftpb::Message);
+  m->set_type(raftpb::MsgReadIndex);
+  m->set_from(from);
+  return m;
+}
+
+// acks one round the way the leader does: Advance once a quorum acked.
+static size_t AckRound(ReadOnly* read_only, uint64_t from, const std::string& ctx,
+                       std::vector<ReadOnly::ReadRequest>* released) {
+  auto ack = Ack(from, ctx);
+  if (read_only->RecvAck(ack) < 2) {
+    return 0;
+  }
+  return read_only->Advance(ack, released);
+}
+
+static void TestSafeBatches() {
+  ReadOnly read_only(ReadOnly::ReadOnlySafe, 1);
+  read_only.SetVoters({2, 3});
+
+  read_only.AddRequest(5, Request(1));
+  read_only.AddRequest(6, Request(1));
+  assert(read_only.HasOpenBatch());
+  std::string first = read_only.SealBatch(100);
+  read_only.AddRequest(7, Request(1));
+  std::string second = read_only.SealBatch(200);
+  assert(2 == ReadOnly::DecodeContext(second));
+  assert(second == read_only.LastPendingRequestCtx());
+  assert(3 == read_only.PendingRequests());
+
+  // acking the later round releases both, in order.
+  std::vector<ReadOnly::ReadRequest> released;
+  assert(3 == AckRound(&read_only, 2, second, &released));
+  assert(3 == released.size());
+  assert(6 == released[0].index && 6 == released[1].index && 7 == released[2].index);
+  assert(0 == read_only.PendingRequests());
+  assert("" == read_only.LastPendingRequestCtx());
+
+  // late acks of released rounds change nothing.
+  assert(0 == AckRound(&read_only, 3, first, &released));
+  assert(0 == AckRound(&read_only, 3, second, &released));
+  assert(3 == released.size());
+  assert(!read_only.LeaseValid(0));
+}
+
+// both followers ack every heartbeat round, the faster one alone reaches the
+// quorum and releases the round before the other's ack arrives.
+static void TestLeaseRenewal() {
+  ReadOnly read_only(ReadOnly::ReadOnlyLeaseBased, 1, 1000, 0);
+  read_only.SetVoters({2, 3});
+  assert(!read_only.LeaseValid(0));
+
+  std::vector<ReadOnly::ReadRequest> released;
+  for (uint64_t now = 100; now <= 5000; now += 100) {
+    std::string ctx = read_only.SealBatch(now);
+    AckRound(&read_only, 2, ctx, &released);
+    AckRound(&read_only, 3, ctx, &released);
+    assert(now + 1000 == read_only.LeaseValidUntil());
+    assert(read_only.LeaseValid(now + 999));
+  }
+
+  // with one follower gone the other still renews the lease alone.
+  for (uint64_t now = 5100; now <= 6000; now += 100) {
+    AckRound(&read_only, 3, read_only.SealBatch(now), &released);
+    assert(now + 1000 == read_only.LeaseValidUntil());
+  }
+
+  // a late ack of a released round renews it, up to the round's send time.
+  std::string late = read_only.SealBatch(6100);
+  AckRound(&read_only, 3, read_only.SealBatch(6200), &released);
+  assert(7200 == read_only.LeaseValidUntil());
+  AckRound(&read_only, 2, late, &released);
+  AckRound(&read_only, 3, late, &released);
+  assert(7200 == read_only.LeaseValidUntil());
+  assert(0 == released.size());
+
+  // without acks the lease runs out.
+  for (uint64_t now = 6300; now <= 8000; now += 100) {
+    read_only.SealBatch(now);
+  }
+  assert(!read_only.LeaseValid(8000));
+}
+
+// a round past the lease duration is forgotten, its ack renews nothing.
+static void TestLeaseStaleAck() {
+  ReadOnly read_only(ReadOnly::ReadOnlyLeaseBased, 1, 1000, 100);
+  read_only.SetVoters({2, 3, 4, 5});
+
+  std::vector<ReadOnly::ReadRequest> released;
+  std::string old = read_only.SealBatch(100);
+  AckRound(&read_only, 2, old, &released);
+  AckRound(&read_only, 3, old, &released);
+  assert(1000 == read_only.LeaseValidUntil());
+
+  for (uint64_t now = 200; now <= 2000; now += 100) {
+    AckRound(&read_only, 2, read_only.SealBatch(now), &released);
+  }
+  AckRound(&read_only, 4, old, &released);
+  assert(1000 == read_only.LeaseValidUntil());
+}
+
+int main() {
+  TestSafeBatches();
+  TestLeaseRenewal();
+  TestLeaseStaleAck();
+  printf("ok\n");
+  return 0;
+}
@@ -0,0 +1,110 @@
+#ifndef MYRAFT_TEST_TEST_CLUSTER_H_
+#define MYRAFT_TEST_TEST_CLUSTER_H_
+
+#include <stdint.h>
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <bench/mem_storage.h>
+#include <raft/rawnode.h>
+
+namespace myraft {
+
+// three RawNodes passing messages by hand, so a test decides what is
+// delivered and when.
+class Cluster {
+ public:
+  using Filter = std::function<bool(const raftpb::Message& m)>;
+
+  // tick_interval is long enough by default that a lease never runs out
+  // during a test.
+  explicit Cluster(ReadOnly::ReadOnlyOption option, uint64_t tick_interval = 1000000) {
+    for (uint64_t id = 1; id <= 3; id++) {
+      std::shared_ptr<MemStorage> storage(new MemStorage);
+      Config config{};
+      config.id               = id;
+      config.peers            = {1, 2, 3};
+      config.election_tick    = 10;
+      config.heartbeat_tick   = 1;
+      config.tick_interval    = tick_interval;
+      config.storage          = storage;
+      config.max_size_per_msg = 1 << 20;
+      config.max_inflight_msgs = 256;
+      config.check_quorum     = true;
+      config.read_only_option = option;
+      storages_[id] = storage;
+      nodes_[id].reset(new RawNode(config));
+    }
+  }
+
+  RawNode* Node(uint64_t id) { return nodes_[id].get(); }
+  std::vector<std::string>& Reads(uint64_t id) { return reads_[id]; }
+  Raft::Messages& Wire() { return wire_; }
+
+  // handles the Ready of node id, its messages are put on the wire.
+  void Ready(uint64_t id) {
+    RawNode* node = Node(id);
+    while (node->HasReady()) {
+      myraft::Ready rd;
+      node->GetReady(&rd);
+      storages_[id]->Append(rd.entries);
+      if (0 != rd.hard_state.term()) {
+        storages_[id]->SetHardState(rd.hard_state);
+      }
+      for (auto& m : rd.messages) {
+        wire_.push_back(std::move(m));
+      }
+      for (auto& m : rd.messages_after_append) {
+        wire_.push_back(std::move(m));
+      }
+      for (const auto& rs : rd.read_states) {
+        reads_[id].push_back(rs.request_ctx);
+      }
+      node->Advance(rd);
+    }
+  }
+
+  // delivers until nothing is left in flight, dropping what drop matches.
+  void Stabilize(const Filter& drop = nullptr) {
+    while (true) {
+      for (auto& node : nodes_) {
+        Ready(node.first);
+      }
+      if (wire_.empty()) {
+        return ;
+      }
+
+      Raft::Messages wire;
+      wire.swap(wire_);
+      for (auto& m : wire) {
+        if (!drop || !drop(*m)) {
+          uint64_t to = m->to();
+          Node(to)->Step(std::move(m));
+        }
+      }
+    }
+  }
+
+  bool OnWire(raftpb::MessageType type) const {
+    for (const auto& m : wire_) {
+      if (type == m->type()) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+ private:
+  std::map<uint64_t, std::shared_ptr<MemStorage>> storages_;
+  std::map<uint64_t, std::unique_ptr<RawNode>>    nodes_;
+  std::map<uint64_t, std::vector<std::string>>    reads_;
+  Raft::Messages                                  wire_;
+}; // class Cluster
+
+} // namespace myraft
+
+#endif // MYRAFT_TEST_TEST_CLUSTER_H_
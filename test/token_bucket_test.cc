@@ -0,0 +1,60 @@
+// g++ -std=c++11 -I. -Iutil test/token_bucket_test.cc -o token_bucket_test
+
+#include <assert.h>
+#include <stdio.h>
+
+#include "token_bucket.h"
+
+using namespace myutil;
+
+static void TestTake() {
+  TokenBucket bucket(1000, 100);
+  bucket.Refill(1);
+  assert(bucket.Ready());
+
+  // a take larger than the tokens goes through and is paid off after.
+  bucket.Take(300);
+  assert(!bucket.Ready());
+  bucket.Refill(200001);
+  assert(!bucket.Ready());
+  bucket.Refill(201001);
+  assert(bucket.Ready());
+
+  // idle time saves up no more than burst.
+  bucket.Refill(100000000);
+  bucket.Take(100);
+  assert(!bucket.Ready());
+}
+
+// refills more often than once a token still add up to the rate.
+static void TestLowRate() {
+  TokenBucket bucket(10, 1);
+  bucket.Refill(1);
+  bucket.Take(1);
+
+  uint64_t now = 1;
+  int taken = 0;
+  for (int i = 0; i < 1000; i++) {
+    now += 1000;
+    bucket.Refill(now);
+    if (bucket.Ready()) {
+      bucket.Take(1);
+      taken++;
+    }
+  }
+  assert(10 == taken);
+}
+
+static void TestUnlimited() {
+  TokenBucket bucket(0, 0);
+  bucket.Take(1 << 30);
+  assert(bucket.Ready());
+}
+
+int main() {
+  TestTake();
+  TestLowRate();
+  TestUnlimited();
+  printf("ok\n");
+  return 0;
+}
@@ -0,0 +1,218 @@
+#ifndef MYUTIL_BOUNDED_CHANNEL_H_
+#define MYUTIL_BOUNDED_CHANNEL_H_
+
+#include <errno.h>
+#include <stdint.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <limits>
+
+#include "make_unique.h"
+#include "queue.h"
+#include "unsafe_queue.h"
+
+namespace myutil {
+
+// BoundedChannel is an EventChannel holding at most capacity elements, so a
+// reader that falls behind pushes back on its writers instead of letting
+// the queue grow without limit. TryWrite fails right away when the channel
+// is full, Write waits for room up to a timeout.
+//
+// Watermarks let a producer that cannot block (a socket reader on an event
+// loop) stop feeding the channel early: the high callback runs when a write
+// brings the size up to high, the low callback when a read brings it back
+// down to low. They alternate, and run on the writing or reading thread
+// with the channel's lock held, so they must not call into the channel.
+template <typename ValueType>
+class BoundedChannel {
+ public:
+  using Callback = std::function<void()>;
+
+ public:
+  BoundedChannel(int eventfd, size_t capacity)
+      : eventfd_(eventfd),
+        capacity_(capacity),
+        closed_(false),
+        high_(std::numeric_limits<size_t>::max()),
+        low_(0),
+        above_high_(false) {}
+
+  ~BoundedChannel() {
+    close(eventfd_);
+  }
+
+  BoundedChannel(const BoundedChannel&)            = delete;
+  BoundedChannel& operator=(const BoundedChannel&) = delete;
+  BoundedChannel(BoundedChannel&&)                 = delete;
+  BoundedChannel& operator=(BoundedChannel&&)      = delete;
+
+  int ReadFD() { return eventfd_; }
+  size_t Capacity() const { return capacity_; }
+
+  // before the channel is shared. low < high <= capacity.
+  void SetWatermarks(size_t high, size_t low, Callback on_high, Callback on_low) {
+    high_    = high;
+    low_     = low;
+    on_high_ = std::move(on_high);
+    on_low_  = std::move(on_low);
+  }
+
+  size_t Size() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return queue_.size();
+  }
+
+  // writers blocked in Write give up, and every later write fails.
+  void Close() {
+    {
+      std::lock_guard<std::mutex> guard(mutex_);
+      closed_ = true;
+    }
+    not_full_.notify_all();
+  }
+
+  std::unique_ptr<Queue<ValueType>> Read(
+      size_t max = std::numeric_limits<size_t>::max()) {
+    uint64_t count;
+    while (-1 == read(eventfd_, &count, sizeof(count)) && EINTR == errno) {
+    }
+
+    std::unique_ptr<UnsafeQueue<ValueType>> result = make_unique<UnsafeQueue<ValueType>>();
+    bool left = false;
+    {
+      std::lock_guard<std::mutex> guard(mutex_);
+      while (!queue_.empty() && result->Size() < max) {
+        result->Push(std::move(queue_.front()));
+        queue_.pop_front();
+      }
+      if (above_high_ && queue_.size() <= low_) {
+        above_high_ = false;
+        if (on_low_) {
+          on_low_();
+        }
+      }
+      left = !queue_.empty();
+    }
+
+    // elements left behind by max were already signalled once, and the
+    // signal has just been consumed.
+    if (left) {
+      Signal();
+    }
+    if (!result->Empty()) {
+      not_full_.notify_all();
+    }
+
+    return result;
+  }
+
+  // value is left untouched if the channel is full or closed.
+  bool TryWrite(const ValueType& value) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (closed_ || queue_.size() >= capacity_) {
+      return false;
+    }
+    queue_.push_back(value);
+    return Pushed(&lock);
+  }
+
+  bool TryWrite(ValueType&& value) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (closed_ || queue_.size() >= capacity_) {
+      return false;
+    }
+    queue_.push_back(std::move(value));
+    return Pushed(&lock);
+  }
+
+  // waits up to timeout_us microseconds for room. value is left untouched
+  // on timeout or if the channel is closed.
+  bool Write(const ValueType& value, uint64_t timeout_us) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (!WaitForRoom(&lock, timeout_us)) {
+      return false;
+    }
+    queue_.push_back(value);
+    return Pushed(&lock);
+  }
+
+  bool Write(ValueType&& value, uint64_t timeout_us) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (!WaitForRoom(&lock, timeout_us)) {
+      return false;
+    }
+    queue_.push_back(std::move(value));
+    return Pushed(&lock);
+  }
+
+ private:
+  bool WaitForRoom(std::unique_lock<std::mutex>* lock, uint64_t timeout_us) {
+    return not_full_.wait_for(*lock, std::chrono::microseconds(timeout_us), [this] {
+      return closed_ || queue_.size() < capacity_;
+    }) && !closed_;
+  }
+
+  // called with the lock held, which it releases.
+  bool Pushed(std::unique_lock<std::mutex>* lock) {
+    bool signal = 1 == queue_.size();
+    if (!above_high_ && queue_.size() >= high_) {
+      above_high_ = true;
+      if (on_high_) {
+        on_high_();
+      }
+    }
+    lock->unlock();
+
+    if (signal) {
+      Signal();
+    }
+    return true;
+  }
+
+  void Signal() {
+    uint64_t one = 1;
+    while (sizeof(one) != write(eventfd_, &one, sizeof(one))) {
+      if (EINTR != errno) {
+        //LOGFATAL
+        return ;
+      }
+    }
+  }
+
+ private:
+  int eventfd_;
+  const size_t capacity_;
+
+  std::mutex              mutex_;
+  std::condition_variable not_full_;
+  std::deque<ValueType>   queue_;
+  bool                    closed_;
+
+  size_t   high_;
+  size_t   low_;
+  bool     above_high_;
+  Callback on_high_;
+  Callback on_low_;
+}; // class BoundedChannel
+
+template <typename ValueType>
+std::unique_ptr<BoundedChannel<ValueType>> MakeBoundedChannel(size_t capacity) {
+  int fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+  if (-1 == fd) {
+    return nullptr;
+  }
+
+  return make_unique<BoundedChannel<ValueType>>(fd, capacity);
+}
+
+} // namespace myutil
+
+#endif // MYUTIL_BOUNDED_CHANNEL_H_
@@ -1,12 +1,14 @@
 #ifndef MYUTIL_CHANNEL_H_
 #define MYUTIL_CHANNEL_H_
 
+#include <errno.h>
 #include <unistd.h>
 
 #include <memory>
 #include <utility>
 #include <limits>
 
+#include "make_unique.h"
 #include "queue.h"
 #include "spin_queue.h"
 
@@ -53,7 +55,8 @@ class Channel {
 
   void Write(const ValueType& value) {
     queue_.Push(value);
-    while (1 != (int ret = write(writefd_, " ", 1))) {
+    int ret;
+    while (1 != (ret = write(writefd_, " ", 1))) {
       if (-1 == ret) {
         if (EINTR != errno) {
           //LOGFATAL
@@ -64,7 +67,8 @@ class Channel {
 
   void Write(ValueType&& value) {
     queue_.Push(std::move(value));
-    while (1 != (int ret = write(writefd_, " ", 1))) {
+    int ret;
+    while (1 != (ret = write(writefd_, " ", 1))) {
       if (-1 == ret) {
         if (EINTR != errno) {
           //LOGFATAL
@@ -0,0 +1,99 @@
+#ifndef MYUTIL_EVENT_CHANNEL_H_
+#define MYUTIL_EVENT_CHANNEL_H_
+
+#include <errno.h>
+#include <stdint.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include <memory>
+#include <utility>
+#include <limits>
+
+#include "make_unique.h"
+#include "queue.h"
+#include "spin_queue.h"
+
+namespace myutil {
+
+// EventChannel is a Channel whose wakeups are coalesced through an eventfd:
+// only the write that makes the queue non-empty signals, and Read consumes
+// every signal with a single read(). A burst of N writes costs one write()
+// and one read() instead of N of each.
+//
+// The fd is non-blocking, wait for ReadFD() to become readable (poll, epoll)
+// before calling Read. A wakeup may find nothing to read.
+template <typename ValueType>
+class EventChannel {
+ public:
+  explicit EventChannel(int eventfd)
+      : eventfd_(eventfd) {}
+
+  ~EventChannel() {
+    close(eventfd_);
+  }
+
+  EventChannel(const EventChannel&)            = delete;
+  EventChannel& operator=(const EventChannel&) = delete;
+  EventChannel(EventChannel&&)                 = delete;
+  EventChannel& operator=(EventChannel&&)      = delete;
+
+  int ReadFD() { return eventfd_; }
+
+  std::unique_ptr<Queue<ValueType>> Read(
+      size_t max = std::numeric_limits<size_t>::max()) {
+    uint64_t count;
+    while (-1 == read(eventfd_, &count, sizeof(count)) && EINTR == errno) {
+    }
+
+    std::unique_ptr<Queue<ValueType>> queue = queue_.BatchPop(max);
+    // elements left behind by max were already signalled once, and the
+    // signal has just been consumed.
+    if (!queue_.Empty()) {
+      Signal();
+    }
+
+    return queue;
+  }
+
+  void Write(const ValueType& value) {
+    if (queue_.Push(value)) {
+      Signal();
+    }
+  }
+
+  void Write(ValueType&& value) {
+    if (queue_.Push(std::move(value))) {
+      Signal();
+    }
+  }
+
+ private:
+  void Signal() {
+    uint64_t one = 1;
+    while (sizeof(one) != write(eventfd_, &one, sizeof(one))) {
+      if (EINTR != errno) {
+        //LOGFATAL
+        return ;
+      }
+    }
+  }
+
+ private:
+  int eventfd_;
+  SpinQueue<ValueType> queue_;
+}; // class EventChannel
+
+template <typename ValueType>
+std::unique_ptr<EventChannel<ValueType>> MakeEventChannel() {
+  int fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+  if (-1 == fd) {
+    return nullptr;
+  }
+
+  return make_unique<EventChannel<ValueType>>(fd);
+}
+
+} // namespace myutil
+
+#endif // MYUTIL_EVENT_CHANNEL_H_
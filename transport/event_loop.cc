@@ -0,0 +1,234 @@
+#include "event_loop.h"
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+
+#include <utility>
+
+#include <util/make_unique.h>
+#include <util/util.h>
+
+namespace myutil {
+
+// the token of the wakefd, registrations count up from the one after it.
+static const uint64_t kWakeToken = 0;
+
+uint64_t EventLoop::LoopStats::Percentile(double pct) const {
+  uint64_t target = static_cast<uint64_t>(loops * pct / 100);
+  uint64_t seen = 0;
+  for (int i = 0; i < kBuckets; i++) {
+    seen += histogram[i];
+    if (seen > target) {
+      return 1ull << i;
+    }
+  }
+
+  return max_micros;
+}
+
+std::string EventLoop::LoopStats::String() const {
+  char buf[256];
+  snprintf(buf, sizeof(buf),
+           "loops=%llu, events=%llu, max_events=%llu, avg_us=%llu, p99_us<%llu, max_us=%llu",
+           static_cast<unsigned long long>(loops),
+           static_cast<unsigned long long>(events),
+           static_cast<unsigned long long>(max_events),
+           static_cast<unsigned long long>(0 == loops ? 0 : total_micros / loops),
+           static_cast<unsigned long long>(Percentile(99)),
+           static_cast<unsigned long long>(max_micros));
+  return buf;
+}
+
+EventLoop::EventLoop(int epollfd, int wakefd, size_t max_events)
+    : epollfd_(epollfd),
+      wakefd_(wakefd),
+      events_(max_events),
+      next_token_(kWakeToken + 1),
+      stopped_(false) {
+  ResetStats();
+}
+
+EventLoop::~EventLoop() {
+  close(wakefd_);
+  close(epollfd_);
+}
+
+bool EventLoop::Add(int fd, uint32_t events, Callback callback) {
+  struct epoll_event event;
+  memset(&event, 0, sizeof(event));
+  event.events = events | EPOLLET;
+  event.data.u64 = next_token_;
+  if (0 != epoll_ctl(epollfd_, EPOLL_CTL_ADD, fd, &event)) {
+    return false;
+  }
+
+  Registration& registration = registrations_[fd];
+  registration.token    = next_token_++;
+  registration.callback = std::make_shared<Callback>(std::move(callback));
+  callbacks_[registration.token] = registration.callback;
+  return true;
+}
+
+bool EventLoop::Modify(int fd, uint32_t events) {
+  auto iter = registrations_.find(fd);
+  if (registrations_.end() == iter) {
+    return false;
+  }
+
+  struct epoll_event event;
+  memset(&event, 0, sizeof(event));
+  event.events = events | EPOLLET;
+  event.data.u64 = iter->second.token;
+  return 0 == epoll_ctl(epollfd_, EPOLL_CTL_MOD, fd, &event);
+}
+
+bool EventLoop::Remove(int fd) {
+  auto iter = registrations_.find(fd);
+  if (registrations_.end() == iter) {
+    return false;
+  }
+
+  callbacks_.erase(iter->second.token);
+  registrations_.erase(iter);
+  return 0 == epoll_ctl(epollfd_, EPOLL_CTL_DEL, fd, nullptr);
+}
+
+int EventLoop::AddTimer(uint64_t interval, TimerCallback callback) {
+  int timerfd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+  if (-1 == timerfd) {
+    return -1;
+  }
+
+  struct itimerspec spec;
+  spec.it_interval.tv_sec  = interval / 1000000;
+  spec.it_interval.tv_nsec = interval % 1000000 * 1000;
+  spec.it_value = spec.it_interval;
+  if (0 != timerfd_settime(timerfd, 0, &spec, nullptr)) {
+    close(timerfd);
+    return -1;
+  }
+
+  bool added = Add(timerfd, EPOLLIN, [timerfd, callback](uint32_t) {
+    uint64_t expirations = 0;
+    if (sizeof(expirations) == read(timerfd, &expirations, sizeof(expirations))) {
+      callback(expirations);
+    }
+  });
+  if (!added) {
+    close(timerfd);
+    return -1;
+  }
+
+  return timerfd;
+}
+
+bool EventLoop::RemoveTimer(int timerfd) {
+  bool removed = Remove(timerfd);
+  close(timerfd);
+  return removed;
+}
+
+int EventLoop::RunOnce(int timeout_ms) {
+  int count = epoll_wait(epollfd_, events_.data(), static_cast<int>(events_.size()), timeout_ms);
+  if (-1 == count) {
+    return EINTR == errno ? 0 : -1;
+  }
+
+  uint64_t start = MonotonicMicros();
+  for (int i = 0; i < count; i++) {
+    uint64_t token = events_[i].data.u64;
+    if (kWakeToken == token) {
+      uint64_t value;
+      while (-1 == read(wakefd_, &value, sizeof(value)) && EINTR == errno) {
+      }
+      continue;
+    }
+
+    auto iter = callbacks_.find(token);
+    if (callbacks_.end() == iter) {
+      // removed by an earlier callback of this batch.
+      continue;
+    }
+    // keeps the callback alive should it remove itself.
+    std::shared_ptr<Callback> callback = iter->second;
+    (*callback)(events_[i].events);
+  }
+  RecordLoop(count, MonotonicMicros() - start);
+
+  // a full batch hints at more ready fds than room, grow for the next wait.
+  if (static_cast<size_t>(count) == events_.size()) {
+    events_.resize(events_.size() * 2);
+  }
+
+  return count;
+}
+
+void EventLoop::Run() {
+  while (!stopped_.load(std::memory_order_acquire)) {
+    if (-1 == RunOnce(-1)) {
+      //LOGFATAL
+      return ;
+    }
+  }
+}
+
+void EventLoop::Stop() {
+  stopped_.store(true, std::memory_order_release);
+
+  uint64_t one = 1;
+  while (-1 == write(wakefd_, &one, sizeof(one)) && EINTR == errno) {
+  }
+}
+
+void EventLoop::ResetStats() {
+  memset(&stats_, 0, sizeof(stats_));
+}
+
+void EventLoop::RecordLoop(uint64_t events, uint64_t micros) {
+  stats_.loops++;
+  stats_.events += events;
+  stats_.total_micros += micros;
+  if (events > stats_.max_events) {
+    stats_.max_events = events;
+  }
+  if (micros > stats_.max_micros) {
+    stats_.max_micros = micros;
+  }
+
+  int bucket = 0;
+  while (bucket < LoopStats::kBuckets - 1 && (1ull << bucket) <= micros) {
+    bucket++;
+  }
+  stats_.histogram[bucket]++;
+}
+
+std::unique_ptr<EventLoop> MakeEventLoop(size_t max_events) {
+  int epollfd = epoll_create1(EPOLL_CLOEXEC);
+  if (-1 == epollfd) {
+    return nullptr;
+  }
+
+  int wakefd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+  if (-1 == wakefd) {
+    close(epollfd);
+    return nullptr;
+  }
+
+  struct epoll_event event;
+  memset(&event, 0, sizeof(event));
+  event.events = EPOLLIN | EPOLLET;
+  event.data.u64 = kWakeToken;
+  if (0 != epoll_ctl(epollfd, EPOLL_CTL_ADD, wakefd, &event)) {
+    close(wakefd);
+    close(epollfd);
+    return nullptr;
+  }
+
+  return make_unique<EventLoop>(epollfd, wakefd, 0 == max_events ? 1 : max_events);
+}
+
+} // namespace myutil
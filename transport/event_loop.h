@@ -0,0 +1,108 @@
+#ifndef MYUTIL_EVENT_LOOP_H_
+#define MYUTIL_EVENT_LOOP_H_
+
+#include <stdint.h>
+#include <sys/epoll.h>
+
+#include <atomic>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace myutil {
+
+// EventLoop is a single-threaded epoll reactor. Every fd is registered
+// edge-triggered, so a callback must consume its fd until EAGAIN (an
+// EventChannel::Read or a timer read does that in one call). Each wakeup
+// dispatches the whole batch of ready fds before waiting again.
+//
+// Everything except Stop must be called from the loop thread or before Run.
+class EventLoop {
+ public:
+  // events is the EPOLLIN/EPOLLOUT/EPOLLERR... mask that fired.
+  using Callback = std::function<void(uint32_t events)>;
+  // expirations is the number of intervals elapsed since the last call,
+  // more than 1 if the loop fell behind.
+  using TimerCallback = std::function<void(uint64_t expirations)>;
+
+  struct LoopStats {
+    static const int kBuckets = 24;
+
+    uint64_t loops;
+    uint64_t events;
+    uint64_t max_events;
+    // time spent dispatching one batch, in microseconds.
+    uint64_t total_micros;
+    uint64_t max_micros;
+    // histogram[i] counts batches that took [2^(i-1), 2^i) microseconds,
+    // the last bucket takes everything longer.
+    uint64_t histogram[kBuckets];
+
+    // the upper bound of the bucket holding the pct percentile.
+    uint64_t Percentile(double pct) const;
+    std::string String() const;
+  }; // struct LoopStats
+
+ public:
+  EventLoop(int epollfd, int wakefd, size_t max_events);
+  ~EventLoop();
+
+  EventLoop(const EventLoop&)            = delete;
+  EventLoop& operator=(const EventLoop&) = delete;
+  EventLoop(EventLoop&&)                 = delete;
+  EventLoop& operator=(EventLoop&&)      = delete;
+
+  bool Add(int fd, uint32_t events, Callback callback);
+  bool Modify(int fd, uint32_t events);
+  // the fd is not closed. Safe to call from a callback, a pending event of
+  // the removed fd in the same batch is dropped, even if a later callback
+  // registers a new fd under the same number.
+  bool Remove(int fd);
+
+  // fires callback every interval microseconds, returns the timerfd which
+  // RemoveTimer takes, or -1 on error.
+  int  AddTimer(uint64_t interval, TimerCallback callback);
+  bool RemoveTimer(int timerfd);
+
+  // dispatches one batch, waiting at most timeout_ms (-1 is forever).
+  // Returns the number of events dispatched, -1 on error.
+  int  RunOnce(int timeout_ms);
+  // loops until Stop is called.
+  void Run();
+  // thread-safe.
+  void Stop();
+
+  const LoopStats& Stats() const { return stats_; }
+  void ResetStats();
+
+ private:
+  void RecordLoop(uint64_t events, uint64_t micros);
+
+ private:
+  // an epoll event carries the token of the registration, not the fd, whose
+  // number can be reused while the event is pending.
+  struct Registration {
+    uint64_t                  token;
+    std::shared_ptr<Callback> callback;
+  }; // struct Registration
+
+ private:
+  const int epollfd_;
+  const int wakefd_;
+  std::vector<struct epoll_event> events_;
+  // by fd, and the same callbacks by token.
+  std::map<int, Registration> registrations_;
+  std::map<uint64_t, std::shared_ptr<Callback>> callbacks_;
+  uint64_t next_token_;
+  std::atomic<bool> stopped_;
+  LoopStats stats_;
+}; // class EventLoop
+
+// nullptr if the epoll or eventfd cannot be created.
+std::unique_ptr<EventLoop> MakeEventLoop(size_t max_events = 256);
+
+} // namespace myutil
+
+#endif // MYUTIL_EVENT_LOOP_H_
@@ -0,0 +1,192 @@
+#include "frame.h"
+
+#include <errno.h>
+#include <unistd.h>
+
+#include <util/coding.h>
+
+namespace myraft {
+
+static const size_t kReadSize = 64 << 10;
+
+bool OutFrame::Init(uint64_t group_id, uint64_t seq) {
+  this->group_id = group_id;
+  uint32_t flags = 0;
+  prefix_size = kFrameHeaderSize;
+  if (0 != seq) {
+    flags |= kFrameSequenced;
+    myutil::EncodeFixed64(prefix + prefix_size, seq);
+    prefix_size += 8;
+  }
+  if (0 != group_id) {
+    flags |= kFrameGrouped;
+    myutil::EncodeFixed64(prefix + prefix_size, group_id);
+    prefix_size += 8;
+  }
+  if (message.compressed) {
+    flags |= kFrameCompressed;
+    myutil::EncodeFixed32(prefix + prefix_size, static_cast<uint32_t>(message.header.size()));
+    myutil::EncodeFixed32(prefix + prefix_size + 4, message.raw_entries_size);
+    prefix_size += 8;
+  }
+
+  // past kFrameLengthMask the length would run into the flags.
+  size_t length = prefix_size - kFrameHeaderSize + message.Size();
+  if (length > kMaxFrameSize) {
+    return false;
+  }
+  myutil::EncodeFixed32(prefix, static_cast<uint32_t>(length) | flags);
+  return true;
+}
+
+void OutFrame::InitHello(uint64_t id, uint32_t features, uint64_t epoch) {
+  message  = EncodedMessage();
+  group_id = 0;
+  myutil::EncodeFixed32(prefix, 20 | kFrameHello);
+  myutil::EncodeFixed64(prefix + 4, id);
+  myutil::EncodeFixed32(prefix + 12, features);
+  myutil::EncodeFixed64(prefix + 16, epoch);
+  prefix_size = 24;
+}
+
+int OutFrame::FillIovec(size_t offset, struct iovec* iov) const {
+  const char* pieces[3];
+  size_t sizes[3];
+  int n = 0;
+
+  pieces[n] = prefix;
+  sizes[n++] = prefix_size;
+  pieces[n] = message.header.data();
+  sizes[n++] = message.header.size();
+  if (message.entries) {
+    pieces[n] = message.entries->data();
+    sizes[n++] = message.entries->size();
+  }
+
+  int count = 0;
+  for (int i = 0; i < n; i++) {
+    if (offset >= sizes[i]) {
+      offset -= sizes[i];
+      continue;
+    }
+    iov[count].iov_base = const_cast<char*>(pieces[i] + offset);
+    iov[count].iov_len  = sizes[i] - offset;
+    count++;
+    offset = 0;
+  }
+
+  return count;
+}
+
+FrameReader::Status FrameReader::ReadFrom(int fd) {
+  while (true) {
+    size_t size = buffer_.size();
+    buffer_.resize(size + kReadSize);
+    ssize_t count = read(fd, &buffer_[size], kReadSize);
+    buffer_.resize(size + (count > 0 ? count : 0));
+
+    if (count > 0) {
+      continue;
+    }
+    if (0 == count) {
+      return Eof;
+    }
+    if (EINTR == errno) {
+      continue;
+    }
+    return EAGAIN == errno || EWOULDBLOCK == errno ? Again : ErrRead;
+  }
+}
+
+FrameReader::Status FrameReader::Next(raftpb::Message* m) {
+  size_t available = buffer_.size() - offset_;
+  if (available < kFrameHeaderSize) {
+    Compact();
+    return Again;
+  }
+
+  uint32_t word = myutil::DecodeFixed32(buffer_.data() + offset_);
+  uint32_t length = word & kFrameLengthMask;
+  if (length > kMaxFrameSize) {
+    return ErrCorrupt;
+  }
+  if (available < kFrameHeaderSize + length) {
+    Compact();
+    return Again;
+  }
+
+  const char* data = buffer_.data() + offset_ + kFrameHeaderSize;
+  uint32_t size = length;
+  seq_ = 0;
+  group_ = 0;
+  if (0 != (word & kFrameSequenced)) {
+    if (size < 8) {
+      return ErrCorrupt;
+    }
+    seq_ = myutil::DecodeFixed64(data);
+    data += 8;
+    size -= 8;
+  }
+  if (0 != (word & kFrameGrouped)) {
+    if (size < 8) {
+      return ErrCorrupt;
+    }
+    group_ = myutil::DecodeFixed64(data);
+    data += 8;
+    size -= 8;
+  }
+
+  Status status = OK;
+  if (0 != (word & kFrameHello)) {
+    if (20 != size) {
+      return ErrCorrupt;
+    }
+    hello_id_       = myutil::DecodeFixed64(data);
+    hello_features_ = myutil::DecodeFixed32(data + 8);
+    hello_epoch_    = myutil::DecodeFixed64(data + 12);
+    status = Hello;
+  } else if (0 != (word & kFrameCompressed)) {
+    status = ParseCompressed(data, size, m);
+  } else if (!m->ParseFromArray(data, size)) {
+    // ParseFromArray clears m but keeps the memory of its repeated fields.
+    status = ErrCorrupt;
+  }
+
+  if (ErrCorrupt != status) {
+    frame_size_ = kFrameHeaderSize + length;
+    offset_ += frame_size_;
+  }
+  return status;
+}
+
+FrameReader::Status FrameReader::ParseCompressed(const char* data, uint32_t length,
+                                                 raftpb::Message* m) {
+  if (length < 8) {
+    return ErrCorrupt;
+  }
+  uint32_t header_size = myutil::DecodeFixed32(data);
+  uint32_t raw_size    = myutil::DecodeFixed32(data + 4);
+  if (header_size > length - 8 || raw_size > kMaxFrameSize) {
+    return ErrCorrupt;
+  }
+
+  scratch_.clear();
+  const char* entries = data + 8 + header_size;
+  if (!m->ParseFromArray(data + 8, header_size) ||
+      !InflateEntries(entries, length - 8 - header_size, raw_size, &scratch_) ||
+      !m->MergeFromString(scratch_)) {
+    return ErrCorrupt;
+  }
+  return OK;
+}
+
+void FrameReader::Compact() {
+  if (0 == offset_) {
+    return ;
+  }
+
+  buffer_.erase(0, offset_);
+  offset_ = 0;
+}
+
+} // namespace myraft
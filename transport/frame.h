@@ -0,0 +1,148 @@
+#ifndef MYRAFT_FRAME_H_
+#define MYRAFT_FRAME_H_
+
+#include <stdint.h>
+#include <sys/uio.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <raft/message_encoder.h>
+#include <raft/raftpb/raft.pb.h>
+
+namespace myraft {
+
+// a frame on the wire is a fixed32 little-endian word, whose low 28 bits
+// are the length of what follows and whose high bits tell what it is:
+//
+//   plain:      length | serialized raftpb::Message
+//   compressed: length | kFrameCompressed, fixed32 header size, fixed32
+//               inflated size, the message without entries, the deflated
+//               Entries field (see EncodedMessage)
+//   hello:      length | kFrameHello, fixed64 node id, fixed32 features,
+//               fixed64 epoch
+//
+// kFrameSequenced and kFrameGrouped may be set on a plain or compressed
+// frame, a fixed64 sequence number and then a fixed64 group id come right
+// after the word. An untagged frame belongs to group 0.
+//
+// A connection starts with a hello, which tells the receiver what the
+// sender can take on the connections going the other way, and which set of
+// connections (epoch) this one belongs to. Sequence numbers order the
+// frames of a group across the connections of one epoch.
+static const size_t   kFrameHeaderSize = 4;
+static const uint32_t kMaxFrameSize    = 64 << 20;
+static const uint32_t kFrameCompressed = 1u << 31;
+static const uint32_t kFrameHello      = 1u << 30;
+static const uint32_t kFrameSequenced  = 1u << 29;
+static const uint32_t kFrameGrouped    = 1u << 28;
+static const uint32_t kFrameLengthMask = kFrameGrouped - 1;
+
+// features of a hello.
+static const uint32_t kFeatureCompression = 1;
+
+// OutFrame is a frame waiting to be written, kept as up to three pieces so
+// the shared entries of an EncodedMessage are never copied.
+struct OutFrame {
+  static const size_t kMaxPrefixSize = 32;
+
+  char           prefix[kMaxPrefixSize];
+  size_t         prefix_size;
+  EncodedMessage message;
+  // as given to Init.
+  uint64_t       group_id;
+
+  OutFrame() : prefix_size(0), group_id(0) {}
+
+  // fills the prefix for message of group_id, a seq of 0 leaves it
+  // unsequenced. Returns false if the frame would be longer than
+  // kMaxFrameSize, which the receiver takes for corruption.
+  bool Init(uint64_t group_id = 0, uint64_t seq = 0);
+  void InitHello(uint64_t id, uint32_t features, uint64_t epoch);
+  size_t Size() const { return prefix_size + message.Size(); }
+  // appends the pieces of the frame past offset to iov, returns the count.
+  int  FillIovec(size_t offset, struct iovec* iov) const;
+}; // struct OutFrame
+
+// FrameReader buffers bytes read from a stream socket and cuts them into
+// frames. Messages are parsed into caller owned objects, which keeps the
+// allocations of their entries around from one frame to the next.
+class FrameReader {
+ public:
+  enum Status {
+    OK,
+    // a hello was read, see HelloId and HelloFeatures.
+    Hello,
+    // nothing more to read for now.
+    Again,
+    Eof,
+    ErrRead,
+    ErrCorrupt,
+  }; // enum Status
+
+  static std::string StatusString(Status status) {
+    static const char* kStatusStrings[] = {
+      "OK",
+      "frame: hello",
+      "frame: no more data",
+      "frame: end of stream",
+      "frame: read error",
+      "frame: corrupt frame",
+    };
+
+    return kStatusStrings[status];
+  }
+
+ public:
+  FrameReader()
+      : offset_(0), frame_size_(0), seq_(0), group_(0),
+        hello_id_(0), hello_features_(0), hello_epoch_(0) {}
+  ~FrameReader() = default;
+
+  FrameReader(const FrameReader&)            = delete;
+  FrameReader& operator=(const FrameReader&) = delete;
+  FrameReader(FrameReader&&)                 = default;
+  FrameReader& operator=(FrameReader&&)      = default;
+
+  // reads from the non-blocking fd until it would block. Returns Again when
+  // the socket is drained, Eof or ErrRead when the stream is over; anything
+  // buffered before that can still be taken with Next.
+  Status ReadFrom(int fd);
+
+  // parses the next complete frame into m. Returns Again if no complete
+  // frame is buffered, Hello if the frame was a hello.
+  Status Next(raftpb::Message* m);
+
+  // of the last message, 0 if it was not sequenced.
+  uint64_t Seq()           const { return seq_; }
+  uint64_t Group()         const { return group_; }
+  // wire bytes of the last frame.
+  size_t   FrameSize()     const { return frame_size_; }
+  uint64_t HelloId()       const { return hello_id_; }
+  uint32_t HelloFeatures() const { return hello_features_; }
+  uint64_t HelloEpoch()    const { return hello_epoch_; }
+
+  // appends the raw bytes, for readers that get them some other way.
+  void Feed(const char* data, size_t size) { buffer_.append(data, size); }
+
+ private:
+  void Compact();
+  Status ParseCompressed(const char* data, uint32_t length, raftpb::Message* m);
+
+ private:
+  std::string buffer_;
+  size_t      offset_;
+  // inflated entries, kept to reuse its memory.
+  std::string scratch_;
+  size_t      frame_size_;
+  uint64_t    seq_;
+  uint64_t    group_;
+  uint64_t    hello_id_;
+  uint32_t    hello_features_;
+  uint64_t    hello_epoch_;
+}; // class FrameReader
+
+} // namespace myraft
+
+#endif // MYRAFT_FRAME_H_
@@ -0,0 +1,226 @@
+#include "loopback_transport.h"
+
+#include <poll.h>
+#include <time.h>
+
+#include <util/util.h>
+
+namespace myraft {
+
+void LoopbackTransport::Send(uint64_t group_id, std::unique_ptr<raftpb::Message> m) {
+  m->set_from(id_);
+  network_->Submit(group_id, std::move(m));
+}
+
+void LoopbackTransport::Send(uint64_t group_id, Messages* msgs) {
+  for (auto& m : *msgs) {
+    Send(group_id, std::move(m));
+  }
+  msgs->clear();
+}
+
+LoopbackNetwork::LoopbackNetwork(uint32_t seed)
+    : default_link_(LinkOptions{0, 0, 0}),
+      next_seq_(0),
+      random_(seed),
+      uniform_(0, 1),
+      stopped_(true),
+      sent_(0),
+      delivered_(0),
+      dropped_(0),
+      bytes_(0) {}
+
+LoopbackNetwork::~LoopbackNetwork() {
+  Stop();
+
+  while (!in_flight_.empty()) {
+    delete in_flight_.top();
+    in_flight_.pop();
+  }
+  if (inbox_) {
+    std::unique_ptr<myutil::Queue<Submitted>> queue = inbox_->Read();
+    while (!queue->Empty()) {
+      delete queue->Pop().m;
+    }
+  }
+}
+
+Transport* LoopbackNetwork::AddNode(uint64_t id, Transport::Handler* handler) {
+  Node& node = nodes_[id];
+  node.transport.reset(new LoopbackTransport(id, this));
+  node.handler = handler;
+  return node.transport.get();
+}
+
+void LoopbackNetwork::SetDefaultLink(const LinkOptions& options) {
+  std::lock_guard<std::mutex> guard(links_mutex_);
+  default_link_ = options;
+}
+
+void LoopbackNetwork::SetLink(uint64_t from, uint64_t to, const LinkOptions& options) {
+  std::lock_guard<std::mutex> guard(links_mutex_);
+  link_options_[std::make_pair(from, to)] = options;
+}
+
+void LoopbackNetwork::Partition(uint64_t a, uint64_t b, bool partitioned) {
+  std::lock_guard<std::mutex> guard(links_mutex_);
+  if (partitioned) {
+    LinkOptions options = default_link_;
+    options.drop_rate = 1;
+    link_options_[std::make_pair(a, b)] = options;
+    link_options_[std::make_pair(b, a)] = options;
+  } else {
+    link_options_.erase(std::make_pair(a, b));
+    link_options_.erase(std::make_pair(b, a));
+  }
+}
+
+bool LoopbackNetwork::Start() {
+  // kept across Stop, a send racing with it may still write to it.
+  if (!inbox_) {
+    inbox_ = myutil::MakeEventChannel<Submitted>();
+    if (!inbox_) {
+      return false;
+    }
+  }
+
+  stopped_ = false;
+  thread_ = std::thread(&LoopbackNetwork::Run, this);
+  return true;
+}
+
+void LoopbackNetwork::Stop() {
+  if (stopped_.exchange(true)) {
+    return ;
+  }
+
+  // a nullptr only wakes the delivery thread up.
+  inbox_->Write(Submitted{0, nullptr});
+  thread_.join();
+}
+
+LoopbackNetwork::Stats LoopbackNetwork::GetStats() const {
+  return Stats{sent_.load(), delivered_.load(), dropped_.load(), bytes_.load()};
+}
+
+void LoopbackNetwork::Submit(uint64_t group_id, std::unique_ptr<raftpb::Message> m) {
+  sent_++;
+  // stopped_ is cleared only once inbox_ exists.
+  if (stopped_.load()) {
+    dropped_++;
+    return ;
+  }
+  inbox_->Write(Submitted{group_id, m.release()});
+}
+
+void LoopbackNetwork::Run() {
+  while (!stopped_.load()) {
+    uint64_t now = myutil::MonotonicMicros();
+    std::unique_ptr<myutil::Queue<Submitted>> queue = inbox_->Read();
+    while (!queue->Empty()) {
+      Submitted submitted = queue->Pop();
+      if (nullptr != submitted.m) {
+        Admit(submitted.group_id, std::unique_ptr<raftpb::Message>(submitted.m), now);
+      }
+    }
+
+    Deliver(myutil::MonotonicMicros());
+
+    // sleep until the next arrival or a new send.
+    struct timespec timeout;
+    struct timespec* ptimeout = nullptr;
+    if (!in_flight_.empty()) {
+      now = myutil::MonotonicMicros();
+      uint64_t wait = in_flight_.top()->arrival > now ? in_flight_.top()->arrival - now : 0;
+      timeout.tv_sec  = wait / 1000000;
+      timeout.tv_nsec = wait % 1000000 * 1000;
+      ptimeout = &timeout;
+    }
+    struct pollfd pfd;
+    pfd.fd     = inbox_->ReadFD();
+    pfd.events = POLLIN;
+    ppoll(&pfd, 1, ptimeout, nullptr);
+  }
+}
+
+void LoopbackNetwork::Admit(uint64_t group_id, std::unique_ptr<raftpb::Message> m,
+                            uint64_t now) {
+  auto from = nodes_.find(m->from());
+  if (nodes_.end() == nodes_.find(m->to())) {
+    dropped_++;
+    if (nodes_.end() != from) {
+      from->second.handler->ReportUnreachable(m->to());
+      if (raftpb::MsgSnap == m->type()) {
+        from->second.handler->ReportSnapshot(group_id, m->to(), true);
+      }
+    }
+    return ;
+  }
+
+  Link* link = GetLink(m->from(), m->to());
+  if (link->options.drop_rate > 0 && uniform_(random_) < link->options.drop_rate) {
+    dropped_++;
+    if (nodes_.end() != from) {
+      // a lost message is a loss, a partition is an unreachable peer.
+      if (link->options.drop_rate >= 1) {
+        from->second.handler->ReportUnreachable(m->to());
+      }
+      if (raftpb::MsgSnap == m->type()) {
+        from->second.handler->ReportSnapshot(group_id, m->to(), true);
+      }
+    }
+    return ;
+  }
+
+  uint64_t size = m->ByteSizeLong();
+  bytes_ += size;
+
+  // the link serializes one message at a time.
+  uint64_t start = link->busy_until > now ? link->busy_until : now;
+  link->busy_until = start;
+  if (0 != link->options.bandwidth) {
+    link->busy_until += size * 1000000 / link->options.bandwidth;
+  }
+
+  InFlight* in_flight = new InFlight;
+  in_flight->arrival  = link->busy_until + link->options.latency;
+  in_flight->seq      = next_seq_++;
+  in_flight->group_id = group_id;
+  in_flight->m        = std::move(m);
+  in_flight_.push(in_flight);
+}
+
+void LoopbackNetwork::Deliver(uint64_t now) {
+  // everything due is handed over with one call per destination and group.
+  std::map<std::pair<uint64_t, uint64_t>, Transport::Messages> batches;
+  while (!in_flight_.empty() && in_flight_.top()->arrival <= now) {
+    std::unique_ptr<InFlight> in_flight(in_flight_.top());
+    in_flight_.pop();
+
+    raftpb::Message* m = in_flight->m.get();
+    if (raftpb::MsgSnap == m->type()) {
+      auto from = nodes_.find(m->from());
+      if (nodes_.end() != from) {
+        from->second.handler->ReportSnapshot(in_flight->group_id, m->to(), false);
+      }
+    }
+    batches[std::make_pair(m->to(), in_flight->group_id)].push_back(std::move(in_flight->m));
+  }
+
+  for (auto& batch : batches) {
+    delivered_ += batch.second.size();
+    nodes_[batch.first.first].handler->HandleMessages(batch.first.second, &batch.second);
+  }
+}
+
+LoopbackNetwork::Link* LoopbackNetwork::GetLink(uint64_t from, uint64_t to) {
+  auto key = std::make_pair(from, to);
+  Link& link = links_[key];
+
+  std::lock_guard<std::mutex> guard(links_mutex_);
+  auto iter = link_options_.find(key);
+  link.options = link_options_.end() != iter ? iter->second : default_link_;
+  return &link;
+}
+
+} // namespace myraft
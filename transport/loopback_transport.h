@@ -0,0 +1,162 @@
+#ifndef MYRAFT_LOOPBACK_TRANSPORT_H_
+#define MYRAFT_LOOPBACK_TRANSPORT_H_
+
+#include <stdint.h>
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <random>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <raft/raftpb/raft.pb.h>
+
+#include "event_channel.h"
+#include "transport.h"
+
+namespace myraft {
+
+class LoopbackNetwork;
+
+// LoopbackTransport is one node's endpoint on a LoopbackNetwork.
+class LoopbackTransport : public Transport {
+ public:
+  virtual ~LoopbackTransport() = default;
+
+  using Transport::Send;
+  virtual void Send(uint64_t group_id, std::unique_ptr<raftpb::Message> m) override;
+  virtual void Send(uint64_t group_id, Messages* msgs) override;
+
+ private:
+  friend class LoopbackNetwork;
+
+  LoopbackTransport(uint64_t id, LoopbackNetwork* network)
+      : id_(id), network_(network) {}
+
+ private:
+  const uint64_t   id_;
+  LoopbackNetwork* network_;
+}; // class LoopbackTransport
+
+// LoopbackNetwork connects the nodes of one process without sockets, so a
+// whole cluster can run in a simulation or a benchmark. Every directed link
+// (from, to) has a latency, a bandwidth and a drop rate. A link is FIFO: each
+// message starts transmitting when the one before it is done, and takes its
+// size over the bandwidth, so a large MsgApp delays what follows it.
+//
+// Sends are thread-safe. A delivery thread hands messages to the Handler of
+// their destination in batches, one per group, in order per link.
+class LoopbackNetwork {
+ public:
+  struct LinkOptions {
+    // microseconds from departure to arrival.
+    uint64_t latency;
+    // bytes per second, 0 is unlimited.
+    uint64_t bandwidth;
+    // probability in [0, 1] that a message is lost, 1 partitions the link.
+    double   drop_rate;
+  }; // struct LinkOptions
+
+  struct Stats {
+    uint64_t sent;
+    uint64_t delivered;
+    uint64_t dropped;
+    uint64_t bytes;
+  }; // struct Stats
+
+ public:
+  explicit LoopbackNetwork(uint32_t seed = 0);
+  ~LoopbackNetwork();
+
+  LoopbackNetwork(const LoopbackNetwork&)            = delete;
+  LoopbackNetwork& operator=(const LoopbackNetwork&) = delete;
+  LoopbackNetwork(LoopbackNetwork&&)                 = delete;
+  LoopbackNetwork& operator=(LoopbackNetwork&&)      = delete;
+
+  // before Start. The returned transport belongs to the network.
+  Transport* AddNode(uint64_t id, Transport::Handler* handler);
+
+  // thread-safe, take effect for messages sent afterwards.
+  void SetDefaultLink(const LinkOptions& options);
+  void SetLink(uint64_t from, uint64_t to, const LinkOptions& options);
+  // shorthand for a drop rate of 1 in both directions, or back to default.
+  void Partition(uint64_t a, uint64_t b, bool partitioned);
+
+  bool Start();
+  // undelivered messages are dropped, and so are those sent before Start or
+  // after Stop.
+  void Stop();
+
+  Stats GetStats() const;
+
+ private:
+  friend class LoopbackTransport;
+
+  // a message waiting in the inbox, owned.
+  struct Submitted {
+    uint64_t         group_id;
+    raftpb::Message* m;
+  }; // struct Submitted
+
+  struct InFlight {
+    uint64_t arrival;
+    uint64_t seq;
+    uint64_t group_id;
+    std::unique_ptr<raftpb::Message> m;
+  }; // struct InFlight
+
+  struct Later {
+    bool operator()(const InFlight* a, const InFlight* b) const {
+      return a->arrival > b->arrival || (a->arrival == b->arrival && a->seq > b->seq);
+    }
+  }; // struct Later
+
+  struct Link {
+    LinkOptions options;
+    // when the last message on the link finishes serializing.
+    uint64_t    busy_until;
+  }; // struct Link
+
+  struct Node {
+    std::unique_ptr<LoopbackTransport> transport;
+    Transport::Handler* handler;
+  }; // struct Node
+
+  void Submit(uint64_t group_id, std::unique_ptr<raftpb::Message> m);
+  void Run();
+  void Admit(uint64_t group_id, std::unique_ptr<raftpb::Message> m, uint64_t now);
+  void Deliver(uint64_t now);
+  Link* GetLink(uint64_t from, uint64_t to);
+
+ private:
+  std::map<uint64_t, Node> nodes_;
+
+  // owned pointers, a SpinQueue cannot hold unique_ptr.
+  std::unique_ptr<myutil::EventChannel<Submitted>> inbox_;
+
+  mutable std::mutex links_mutex_;
+  LinkOptions default_link_;
+  std::map<std::pair<uint64_t, uint64_t>, LinkOptions> link_options_;
+
+  // only touched by the delivery thread.
+  std::map<std::pair<uint64_t, uint64_t>, Link> links_;
+  std::priority_queue<InFlight*, std::vector<InFlight*>, Later> in_flight_;
+  uint64_t next_seq_;
+  std::default_random_engine random_;
+  std::uniform_real_distribution<double> uniform_;
+
+  std::atomic<bool>     stopped_;
+  std::thread           thread_;
+  std::atomic<uint64_t> sent_;
+  std::atomic<uint64_t> delivered_;
+  std::atomic<uint64_t> dropped_;
+  std::atomic<uint64_t> bytes_;
+}; // class LoopbackNetwork
+
+} // namespace myraft
+
+#endif // MYRAFT_LOOPBACK_TRANSPORT_H_
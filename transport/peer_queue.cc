@@ -0,0 +1,111 @@
+#include "peer_queue.h"
+
+#include <utility>
+
+namespace myraft {
+
+PeerQueue::Lane PeerQueue::LaneOf(raftpb::MessageType type) {
+  switch (type) {
+    case raftpb::MsgApp:
+      return LaneReplication;
+    case raftpb::MsgSnap:
+      return LaneSnapshot;
+    default:
+      return LaneControl;
+  }
+}
+
+PeerQueue::PeerQueue(std::shared_ptr<myutil::TokenBucket> snapshot_bucket,
+                     size_t max_wire_bytes)
+    : max_wire_bytes_(max_wire_bytes),
+      offset_(0),
+      wire_bytes_(0),
+      pending_bytes_(0),
+      snapshot_bucket_(std::move(snapshot_bucket)),
+      throttled_(false) {}
+
+void PeerQueue::Push(Lane lane, OutFrame&& frame) {
+  pending_bytes_ += frame.Size();
+  lanes_[lane].push_back(std::move(frame));
+}
+
+int PeerQueue::FillIovec(uint64_t now, struct iovec* iov, int max) {
+  Refill(now);
+
+  int count = 0;
+  size_t offset = offset_;
+  for (const auto& wire : wire_) {
+    // a frame takes at most 3 iovecs.
+    if (count + 3 > max) {
+      break;
+    }
+    count += wire.frame.FillIovec(offset, &iov[count]);
+    offset = 0;
+  }
+
+  return count;
+}
+
+void PeerQueue::Consume(size_t written) {
+  pending_bytes_ -= written;
+  wire_bytes_ -= written;
+  while (written > 0) {
+    size_t left = wire_.front().frame.Size() - offset_;
+    if (written < left) {
+      offset_ += written;
+      return ;
+    }
+    written -= left;
+    wire_.pop_front();
+    offset_ = 0;
+  }
+}
+
+void PeerQueue::Clear(std::vector<uint64_t>* snapshots) {
+  for (const auto& wire : wire_) {
+    if (LaneSnapshot == wire.lane) {
+      snapshots->push_back(wire.frame.group_id);
+    }
+  }
+  for (const auto& frame : lanes_[LaneSnapshot]) {
+    snapshots->push_back(frame.group_id);
+  }
+
+  for (auto& lane : lanes_) {
+    lane.clear();
+  }
+  wire_.clear();
+  offset_ = 0;
+  wire_bytes_ = 0;
+  pending_bytes_ = 0;
+  throttled_ = false;
+}
+
+void PeerQueue::Refill(uint64_t now) {
+  snapshot_bucket_->Refill(now);
+
+  throttled_ = false;
+  while (wire_bytes_ < max_wire_bytes_) {
+    Lane lane;
+    if (!lanes_[LaneControl].empty()) {
+      lane = LaneControl;
+    } else if (!lanes_[LaneReplication].empty()) {
+      lane = LaneReplication;
+    } else if (!lanes_[LaneSnapshot].empty()) {
+      if (!snapshot_bucket_->Ready()) {
+        throttled_ = true;
+        return ;
+      }
+      lane = LaneSnapshot;
+      snapshot_bucket_->Take(lanes_[LaneSnapshot].front().Size());
+    } else {
+      return ;
+    }
+
+    wire_bytes_ += lanes_[lane].front().Size();
+    wire_.push_back(WireFrame{std::move(lanes_[lane].front()), lane});
+    lanes_[lane].pop_front();
+  }
+}
+
+} // namespace myraft
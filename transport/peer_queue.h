@@ -0,0 +1,93 @@
+#ifndef MYRAFT_PEER_QUEUE_H_
+#define MYRAFT_PEER_QUEUE_H_
+
+#include <stdint.h>
+#include <sys/uio.h>
+
+#include <deque>
+#include <memory>
+#include <vector>
+
+#include <raft/raftpb/raft.pb.h>
+#include <util/token_bucket.h>
+
+#include "frame.h"
+
+namespace myraft {
+
+// PeerQueue holds the frames waiting for one peer in three lanes, so that
+// heartbeats and votes never wait behind bulk MsgApp or MsgSnap data:
+//   control:     everything but MsgApp and MsgSnap, always taken first;
+//   replication: MsgApp;
+//   snapshot:    MsgSnap, capped by snapshot_bucket.
+//
+// Frames cannot interleave on a stream, so lanes are merged into a short
+// wire queue of at most max_wire_bytes (plus one frame). That bounds how
+// long a newly queued heartbeat waits behind frames already committed to
+// the wire.
+class PeerQueue {
+ public:
+  enum Lane {
+    LaneControl,
+    LaneReplication,
+    LaneSnapshot,
+    kLanes,
+  }; // enum Lane
+
+  static Lane LaneOf(raftpb::MessageType type);
+
+ public:
+  // snapshot_bucket may be shared with whatever else sends snapshots to the
+  // peer, so they stay under one rate together.
+  PeerQueue(std::shared_ptr<myutil::TokenBucket> snapshot_bucket, size_t max_wire_bytes);
+  ~PeerQueue() = default;
+
+  PeerQueue(const PeerQueue&)            = delete;
+  PeerQueue& operator=(const PeerQueue&) = delete;
+  PeerQueue(PeerQueue&&)                 = default;
+  PeerQueue& operator=(PeerQueue&&)      = default;
+
+  void Push(Lane lane, OutFrame&& frame);
+
+  // moves frames from the lanes to the wire queue and describes the wire
+  // queue in at most max iovecs, now is in microseconds. Returns the count.
+  int  FillIovec(uint64_t now, struct iovec* iov, int max);
+  // written bytes of the last FillIovec went out.
+  void Consume(size_t written);
+
+  bool   Empty() const { return 0 == pending_bytes_; }
+  // true iff only snapshot frames are left and they wait for bandwidth.
+  bool   Throttled() const { return wire_.empty() && throttled_; }
+  size_t PendingBytes() const { return pending_bytes_; }
+  // drops every frame not completely written, the group of each MsgSnap
+  // among them is appended to snapshots.
+  void   Clear(std::vector<uint64_t>* snapshots);
+
+ private:
+  struct WireFrame {
+    OutFrame frame;
+    Lane     lane;
+  }; // struct WireFrame
+
+  void Refill(uint64_t now);
+
+ private:
+  const size_t max_wire_bytes_;
+
+  std::deque<OutFrame> lanes_[kLanes];
+  // frames committed to the stream order, wire_.front() is written up to
+  // offset_.
+  std::deque<WireFrame> wire_;
+  size_t offset_;
+  size_t wire_bytes_;
+  size_t pending_bytes_;
+
+  // bytes of the snapshot lane, a frame larger than the burst still goes
+  // out and is paid off over time.
+  std::shared_ptr<myutil::TokenBucket> snapshot_bucket_;
+  bool throttled_;
+}; // class PeerQueue
+
+} // namespace myraft
+
+#endif // MYRAFT_PEER_QUEUE_H_
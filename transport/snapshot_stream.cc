@@ -0,0 +1,238 @@
+#include "snapshot_stream.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <sys/sendfile.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <utility>
+
+#include <util/coding.h>
+
+#include "frame.h"
+
+namespace myraft {
+
+// bytes moved per sendfile/splice call.
+static const size_t kChunkSize = 1 << 20;
+
+SnapshotSender::SnapshotSender(int sock, int file, uint64_t file_size, uint64_t group_id,
+                               const raftpb::Message& m,
+                               std::shared_ptr<myutil::TokenBucket> bucket)
+    : sock_(sock),
+      file_(file),
+      header_offset_(0),
+      file_offset_(0),
+      file_size_(file_size),
+      bucket_(std::move(bucket)) {
+  raftpb::Message head(m);
+  head.mutable_snapshot()->clear_data();
+  std::string encoded;
+  head.SerializeToString(&encoded);
+
+  myutil::PutFixed32(&header_, kSnapshotStreamMagic);
+  myutil::PutFixed64(&header_, group_id);
+  myutil::PutFixed32(&header_, static_cast<uint32_t>(encoded.size()));
+  header_.append(encoded);
+  myutil::PutFixed64(&header_, file_size_);
+}
+
+SnapshotSender::~SnapshotSender() {
+  close(file_);
+}
+
+SnapshotSender::Status SnapshotSender::Send(uint64_t now) {
+  while (header_offset_ < header_.size()) {
+    ssize_t written = write(sock_, header_.data() + header_offset_, header_.size() - header_offset_);
+    if (-1 == written) {
+      if (EINTR == errno) {
+        continue;
+      }
+      return EAGAIN == errno || EWOULDBLOCK == errno ? Again : ErrSend;
+    }
+    header_offset_ += written;
+  }
+
+  bucket_->Refill(now);
+  while (static_cast<uint64_t>(file_offset_) < file_size_) {
+    if (!bucket_->Ready()) {
+      return Throttled;
+    }
+
+    size_t chunk = std::min<uint64_t>(kChunkSize, file_size_ - file_offset_);
+    ssize_t sent = sendfile(sock_, file_, &file_offset_, chunk);
+    if (-1 == sent) {
+      if (EINTR == errno) {
+        continue;
+      }
+      return EAGAIN == errno || EWOULDBLOCK == errno ? Again : ErrSend;
+    }
+    if (0 == sent) {
+      // the file is shorter than when the stream started.
+      return ErrSend;
+    }
+    bucket_->Take(sent);
+  }
+
+  return Done;
+}
+
+SnapshotReceiver::SnapshotReceiver(int sock, const std::string& dir)
+    : sock_(sock),
+      dir_(dir),
+      state_(StateMagic),
+      need_(4),
+      group_(0),
+      file_(-1),
+      remain_(0) {
+  pipe_[0] = -1;
+  pipe_[1] = -1;
+}
+
+SnapshotReceiver::~SnapshotReceiver() {
+  if (-1 != pipe_[0]) {
+    close(pipe_[0]);
+    close(pipe_[1]);
+  }
+  if (-1 != file_) {
+    close(file_);
+  }
+  if (StateDone != state_ && !path_.empty()) {
+    unlink(path_.c_str());
+  }
+}
+
+SnapshotReceiver::Status SnapshotReceiver::Receive() {
+  Status status = Again;
+  while (StateData != state_ && StateDone != state_) {
+    if (!ReadHeader(&status)) {
+      return status;
+    }
+
+    switch (state_) {
+      case StateMagic:
+        if (kSnapshotStreamMagic != myutil::DecodeFixed32(buffer_.data())) {
+          return ErrCorrupt;
+        }
+        state_ = StateGroup;
+        need_ = 8;
+        break;
+      case StateGroup:
+        group_ = myutil::DecodeFixed64(buffer_.data());
+        state_ = StateLength;
+        need_ = 4;
+        break;
+      case StateLength:
+        need_ = myutil::DecodeFixed32(buffer_.data());
+        if (need_ > kMaxFrameSize) {
+          return ErrCorrupt;
+        }
+        state_ = StateMessage;
+        break;
+      case StateMessage:
+        message_.reset(new raftpb::Message);
+        if (!message_->ParseFromString(buffer_) || raftpb::MsgSnap != message_->type()) {
+          return ErrCorrupt;
+        }
+        state_ = StateSize;
+        need_ = 8;
+        break;
+      case StateSize:
+        remain_ = myutil::DecodeFixed64(buffer_.data());
+        if (!OpenFile()) {
+          return ErrWrite;
+        }
+        state_ = StateData;
+        break;
+      default:
+        break;
+    }
+    buffer_.clear();
+  }
+
+  if (StateData == state_) {
+    return ReceiveData();
+  }
+  return Done;
+}
+
+bool SnapshotReceiver::ReadHeader(Status* status) {
+  while (buffer_.size() < need_) {
+    size_t size = buffer_.size();
+    buffer_.resize(need_);
+    // exactly what the header needs, the image is left to splice.
+    ssize_t count = read(sock_, &buffer_[size], need_ - size);
+    buffer_.resize(size + (count > 0 ? count : 0));
+
+    if (count > 0) {
+      continue;
+    }
+    if (-1 == count && EINTR == errno) {
+      continue;
+    }
+    *status = -1 == count && (EAGAIN == errno || EWOULDBLOCK == errno) ? Again : ErrRead;
+    return false;
+  }
+
+  return true;
+}
+
+bool SnapshotReceiver::OpenFile() {
+  std::string path = dir_ + "/snap-XXXXXX";
+  file_ = mkstemp(&path[0]);
+  if (-1 == file_) {
+    return false;
+  }
+  path_ = path;
+
+  if (0 != pipe2(pipe_, O_NONBLOCK | O_CLOEXEC)) {
+    pipe_[0] = -1;
+    pipe_[1] = -1;
+    return false;
+  }
+  return true;
+}
+
+SnapshotReceiver::Status SnapshotReceiver::ReceiveData() {
+  while (remain_ > 0) {
+    size_t chunk = std::min<uint64_t>(kChunkSize, remain_);
+    ssize_t moved = splice(sock_, nullptr, pipe_[1], nullptr, chunk,
+                           SPLICE_F_MOVE | SPLICE_F_NONBLOCK);
+    if (-1 == moved) {
+      if (EINTR == errno) {
+        continue;
+      }
+      return EAGAIN == errno || EWOULDBLOCK == errno ? Again : ErrRead;
+    }
+    if (0 == moved) {
+      return ErrRead;
+    }
+
+    // the pipe is drained every time, the next splice always finds it empty.
+    remain_ -= moved;
+    while (moved > 0) {
+      ssize_t written = splice(pipe_[0], nullptr, file_, nullptr, moved, SPLICE_F_MOVE);
+      if (-1 == written) {
+        if (EINTR == errno) {
+          continue;
+        }
+        return ErrWrite;
+      }
+      moved -= written;
+    }
+  }
+
+  if (0 != fsync(file_)) {
+    return ErrWrite;
+  }
+  close(file_);
+  file_ = -1;
+
+  message_->mutable_snapshot()->set_data(path_);
+  state_ = StateDone;
+  return Done;
+}
+
+} // namespace myraft
@@ -0,0 +1,130 @@
+#ifndef MYRAFT_SNAPSHOT_STREAM_H_
+#define MYRAFT_SNAPSHOT_STREAM_H_
+
+#include <stdint.h>
+
+#include <memory>
+#include <string>
+
+#include <raft/raftpb/raft.pb.h>
+#include <util/token_bucket.h>
+
+namespace myraft {
+
+// A snapshot stream is a connection of its own carrying one MsgSnap whose
+// state machine image lives in a file rather than in Snapshot.Data:
+//
+//   fixed32 kSnapshotStreamMagic
+//   fixed64 raft group id
+//   fixed32 length, length bytes of the MsgSnap with Data cleared
+//   fixed64 size, size bytes of the image file
+//
+// The magic can never be a frame length (see kMaxFrameSize), which lets a
+// listener tell both kinds of connections apart from their first 4 bytes.
+// Both ends move the image between the file and the socket in the kernel
+// (sendfile, splice), so memory use does not depend on the snapshot size.
+static const uint32_t kSnapshotStreamMagic = 0xffffffff;
+
+// SnapshotSender writes one stream to a non-blocking socket.
+class SnapshotSender {
+ public:
+  enum Status {
+    Done,
+    // the socket is full, wait until it is writable.
+    Again,
+    // the rate cap is used up, retry later.
+    Throttled,
+    ErrSend,
+  }; // enum Status
+
+ public:
+  // takes ownership of file but not of sock, m->snapshot().data() is
+  // ignored. bucket caps the image bytes, it may be shared by all the
+  // snapshots to one peer.
+  SnapshotSender(int sock, int file, uint64_t file_size, uint64_t group_id,
+                 const raftpb::Message& m, std::shared_ptr<myutil::TokenBucket> bucket);
+  ~SnapshotSender();
+
+  SnapshotSender(const SnapshotSender&)            = delete;
+  SnapshotSender& operator=(const SnapshotSender&) = delete;
+  SnapshotSender(SnapshotSender&&)                 = delete;
+  SnapshotSender& operator=(SnapshotSender&&)      = delete;
+
+  // sends as much as the socket and the rate cap allow, now is in
+  // microseconds.
+  Status Send(uint64_t now);
+
+ private:
+  const int sock_;
+  const int file_;
+  std::string header_;
+  size_t      header_offset_;
+  off_t       file_offset_;
+  uint64_t    file_size_;
+  std::shared_ptr<myutil::TokenBucket> bucket_;
+}; // class SnapshotSender
+
+// SnapshotReceiver reads one stream from a non-blocking socket, which stays
+// owned by the caller, into a temporary file in dir.
+class SnapshotReceiver {
+ public:
+  enum Status {
+    Done,
+    Again,
+    ErrRead,
+    ErrCorrupt,
+    ErrWrite,
+  }; // enum Status
+
+ public:
+  SnapshotReceiver(int sock, const std::string& dir);
+  // removes the temporary file unless the stream completed.
+  ~SnapshotReceiver();
+
+  SnapshotReceiver(const SnapshotReceiver&)            = delete;
+  SnapshotReceiver& operator=(const SnapshotReceiver&) = delete;
+  SnapshotReceiver(SnapshotReceiver&&)                 = delete;
+  SnapshotReceiver& operator=(SnapshotReceiver&&)      = delete;
+
+  // reads until the socket is drained.
+  Status Receive();
+
+  // once Done, the MsgSnap whose Snapshot.Data is the path of the synced
+  // image file. The file then belongs to the caller.
+  std::unique_ptr<raftpb::Message> TakeMessage() { return std::move(message_); }
+  uint64_t Group() const { return group_; }
+
+ private:
+  enum State {
+    StateMagic,
+    StateGroup,
+    StateLength,
+    StateMessage,
+    StateSize,
+    StateData,
+    StateDone,
+  }; // enum State
+
+  // reads up to need_ bytes into buffer_, true once they are all there.
+  bool   ReadHeader(Status* status);
+  bool   OpenFile();
+  Status ReceiveData();
+
+ private:
+  const int   sock_;
+  const std::string dir_;
+  State       state_;
+  std::string buffer_;
+  size_t      need_;
+  uint64_t    group_;
+  std::unique_ptr<raftpb::Message> message_;
+
+  std::string path_;
+  int         file_;
+  int         pipe_[2];
+  uint64_t    remain_;
+}; // class SnapshotReceiver
+
+} // namespace myraft
+
+#endif // MYRAFT_SNAPSHOT_STREAM_H_
@@ -0,0 +1,782 @@
+#include "tcp_transport.h"
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <utility>
+
+#include <util/coding.h>
+#include <util/util.h>
+
+namespace myraft {
+
+static bool ToSockAddr(const std::string& host, uint16_t port, struct sockaddr_in* addr) {
+  memset(addr, 0, sizeof(*addr));
+  addr->sin_family = AF_INET;
+  addr->sin_port   = htons(port);
+  return 1 == inet_pton(AF_INET, host.c_str(), &addr->sin_addr);
+}
+
+static void SetNoDelay(int fd) {
+  int one = 1;
+  setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+}
+
+// starts a non-blocking connect, -1 on error.
+static int ConnectTo(const std::string& host, uint16_t port) {
+  struct sockaddr_in addr;
+  if (!ToSockAddr(host, port, &addr)) {
+    return -1;
+  }
+
+  int fd = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+  if (-1 == fd) {
+    return -1;
+  }
+  SetNoDelay(fd);
+
+  if (0 != connect(fd, reinterpret_cast<struct sockaddr*>(&addr), sizeof(addr)) &&
+      EINPROGRESS != errno) {
+    close(fd);
+    return -1;
+  }
+  return fd;
+}
+
+static bool ConnectFailed(int fd) {
+  int error = 0;
+  socklen_t len = sizeof(error);
+  return 0 != getsockopt(fd, SOL_SOCKET, SO_ERROR, &error, &len) || 0 != error;
+}
+
+TcpTransport::TcpTransport(uint64_t id, myutil::EventLoop* loop, Handler* handler,
+                           uint64_t snapshot_rate)
+    : id_(id),
+      loop_(loop),
+      handler_(handler),
+      snapshot_rate_(snapshot_rate),
+      throttle_timer_(-1),
+      pause_reading_(false),
+      reading_paused_(false),
+      listenfd_(-1),
+      port_(0),
+      compression_(false),
+      streams_(1),
+      iov_(kMaxIovecs) {}
+
+TcpTransport::~TcpTransport() {
+  for (auto& peer : peers_) {
+    ClosePeer(peer.second.get(), false);
+  }
+  while (!conns_.empty()) {
+    CloseConn(conns_.begin()->first);
+  }
+  while (!snapshots_.empty()) {
+    FinishSnapshot(snapshots_.begin()->first, true);
+  }
+  if (-1 != listenfd_) {
+    loop_->Remove(listenfd_);
+    close(listenfd_);
+  }
+  if (-1 != throttle_timer_) {
+    loop_->RemoveTimer(throttle_timer_);
+  }
+
+  if (outbox_) {
+    loop_->Remove(outbox_->ReadFD());
+    std::unique_ptr<myutil::Queue<Outgoing>> queue = outbox_->Read();
+    while (!queue->Empty()) {
+      delete queue->Pop().m;
+    }
+  }
+}
+
+bool TcpTransport::Start() {
+  outbox_ = myutil::MakeEventChannel<Outgoing>();
+  if (!outbox_) {
+    return false;
+  }
+
+  if (!loop_->Add(outbox_->ReadFD(), EPOLLIN, [this](uint32_t) { HandleOutbox(); })) {
+    return false;
+  }
+
+  if (0 != snapshot_rate_) {
+    throttle_timer_ = loop_->AddTimer(kThrottleInterval, [this](uint64_t) { FlushThrottled(); });
+    if (-1 == throttle_timer_) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool TcpTransport::Listen(const std::string& host, uint16_t port) {
+  struct sockaddr_in addr;
+  if (!ToSockAddr(host, port, &addr)) {
+    return false;
+  }
+
+  int fd = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+  if (-1 == fd) {
+    return false;
+  }
+  int one = 1;
+  setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+
+  socklen_t len = sizeof(addr);
+  if (0 != bind(fd, reinterpret_cast<struct sockaddr*>(&addr), sizeof(addr)) ||
+      0 != listen(fd, SOMAXCONN) ||
+      0 != getsockname(fd, reinterpret_cast<struct sockaddr*>(&addr), &len) ||
+      !loop_->Add(fd, EPOLLIN, [this](uint32_t) { HandleAccept(); })) {
+    close(fd);
+    return false;
+  }
+
+  listenfd_ = fd;
+  port_ = ntohs(addr.sin_port);
+  return true;
+}
+
+void TcpTransport::AddPeer(uint64_t id, const std::string& host, uint16_t port) {
+  if (peers_.end() != peers_.find(id)) {
+    return ;
+  }
+
+  peers_[id] = std::unique_ptr<Peer>(new Peer(id, host, port, snapshot_rate_, streams_));
+  UpdateFeatures(id);
+}
+
+void TcpTransport::RemovePeer(uint64_t id) {
+  auto iter = peers_.find(id);
+  if (peers_.end() == iter) {
+    return ;
+  }
+
+  ClosePeer(iter->second.get(), false);
+  for (auto& dirty : dirty_) {
+    if (nullptr != dirty && iter->second.get() == dirty->peer) {
+      dirty = nullptr;
+    }
+  }
+  peers_.erase(iter);
+}
+
+void TcpTransport::Send(uint64_t group_id, std::unique_ptr<raftpb::Message> m) {
+  outbox_->Write(Outgoing{group_id, m.release()});
+}
+
+void TcpTransport::Send(uint64_t group_id, Messages* msgs) {
+  for (auto& m : *msgs) {
+    outbox_->Write(Outgoing{group_id, m.release()});
+  }
+  msgs->clear();
+}
+
+void TcpTransport::PauseReading() {
+  pause_reading_ = true;
+  outbox_->Write(Outgoing{0, nullptr});
+}
+
+void TcpTransport::ResumeReading() {
+  pause_reading_ = false;
+  outbox_->Write(Outgoing{0, nullptr});
+}
+
+void TcpTransport::HandleOutbox() {
+  UpdateReading();
+
+  std::unique_ptr<myutil::Queue<Outgoing>> queue = outbox_->Read();
+  while (!queue->Empty()) {
+    Outgoing out = queue->Pop();
+    if (nullptr != out.m) {
+      Enqueue(out.group_id, std::unique_ptr<raftpb::Message>(out.m));
+    }
+  }
+
+  // every message of this wakeup, whatever its group, is queued before the
+  // first write, so each connection gets one writev for all of them.
+  for (Stream* stream : dirty_) {
+    if (nullptr != stream) {
+      stream->dirty = false;
+      if (stream->connected) {
+        Flush(stream);
+      }
+    }
+  }
+  dirty_.clear();
+}
+
+void TcpTransport::Enqueue(uint64_t group_id, std::unique_ptr<raftpb::Message> m) {
+  auto iter = peers_.find(m->to());
+  if (peers_.end() == iter) {
+    //Warningf, dropping message to unknown peer
+    ReportDropped(group_id, *m);
+    return ;
+  }
+
+  Peer* peer = iter->second.get();
+  if (raftpb::MsgSnap == m->type() && !snapshot_dir_.empty()) {
+    StartSnapshot(peer, group_id, std::move(m));
+    return ;
+  }
+
+  if (-1 == peer->streams[0]->fd) {
+    if (myutil::MonotonicMicros() < peer->retry_time || !Connect(peer)) {
+      handler_->ReportUnreachable(peer->id);
+      ReportDropped(group_id, *m);
+      return ;
+    }
+  }
+
+  // only MsgApp is striped, the receiver reorders nothing else.
+  Stream* stream = peer->streams[0].get();
+  bool striped = raftpb::MsgApp == m->type() && peer->streams.size() > 1;
+  if (striped) {
+    stream = peer->streams[peer->next_stream].get();
+  }
+  if (stream->queue.PendingBytes() > kMaxPendingBytes) {
+    //Warningf, peer is too slow, dropping message
+    handler_->ReportUnreachable(peer->id);
+    ReportDropped(group_id, *m);
+    return ;
+  }
+
+  OutFrame frame;
+  encoder_.Encode(group_id, m.get(), &frame.message,
+                  peer->compress && raftpb::MsgApp == m->type());
+  // a sequence number is only taken for a frame that goes out, or the
+  // receiver would wait for it.
+  uint64_t seq = 0;
+  if (striped) {
+    seq = peer->next_seqs.insert(std::make_pair(group_id, 1)).first->second;
+  }
+  if (!frame.Init(group_id, seq)) {
+    //Errorf, message is too large for a frame, dropping it
+    handler_->ReportUnreachable(peer->id);
+    ReportDropped(group_id, *m);
+    return ;
+  }
+  if (striped) {
+    peer->next_seqs[group_id]++;
+    peer->next_stream = (peer->next_stream + 1) % peer->streams.size();
+  }
+  stream->queue.Push(PeerQueue::LaneOf(m->type()), std::move(frame));
+
+  if (!stream->dirty) {
+    stream->dirty = true;
+    dirty_.push_back(stream);
+  }
+}
+
+bool TcpTransport::Connect(Peer* peer) {
+  // the receiver only moves to a larger epoch, the wall clock keeps the
+  // epochs of a later incarnation above those of an earlier one, even
+  // across a reboot of this host.
+  uint64_t now = myutil::WallMicros();
+  peer->epoch       = now > peer->epoch ? now : peer->epoch + 1;
+  peer->next_seqs.clear();
+  peer->next_stream = 0;
+
+  for (auto& stream : peer->streams) {
+    if (!ConnectStream(peer, stream.get())) {
+      ClosePeer(peer, false);
+      peer->retry_time = myutil::MonotonicMicros() + kReconnectInterval;
+      return false;
+    }
+  }
+  return true;
+}
+
+bool TcpTransport::ConnectStream(Peer* peer, Stream* stream) {
+  int fd = ConnectTo(peer->host, peer->port);
+  if (-1 == fd) {
+    return false;
+  }
+
+  uint64_t id = peer->id;
+  size_t index = stream->index;
+  if (!loop_->Add(fd, EPOLLIN | EPOLLOUT | EPOLLRDHUP,
+                  [this, id, index](uint32_t events) { HandleStreamEvents(id, index, events); })) {
+    close(fd);
+    return false;
+  }
+
+  stream->fd = fd;
+  stream->connected = false;
+
+  // the queue is empty, the hello goes out first.
+  OutFrame hello;
+  hello.InitHello(id_, compression_ ? kFeatureCompression : 0, peer->epoch);
+  stream->queue.Push(PeerQueue::LaneControl, std::move(hello));
+  return true;
+}
+
+void TcpTransport::HandleStreamEvents(uint64_t id, size_t index, uint32_t events) {
+  auto iter = peers_.find(id);
+  if (peers_.end() == iter) {
+    return ;
+  }
+
+  Peer* peer = iter->second.get();
+  Stream* stream = peer->streams[index].get();
+  if (-1 == stream->fd) {
+    return ;
+  }
+  // striped frames behind a broken connection are lost, the whole set is
+  // closed and the next epoch starts numbering over.
+  if (0 != (events & (EPOLLERR | EPOLLHUP | EPOLLRDHUP))) {
+    ClosePeer(peer, true);
+    return ;
+  }
+
+  if (!stream->connected && 0 != (events & EPOLLOUT)) {
+    if (ConnectFailed(stream->fd)) {
+      ClosePeer(peer, true);
+      return ;
+    }
+    stream->connected = true;
+  }
+
+  if (stream->connected) {
+    Flush(stream);
+  }
+}
+
+void TcpTransport::Flush(Stream* stream) {
+  uint64_t now = myutil::MonotonicMicros();
+  while (!stream->queue.Empty()) {
+    int count = stream->queue.FillIovec(now, iov_.data(), kMaxIovecs);
+    if (0 == count) {
+      // only capped snapshot frames are left, see FlushThrottled.
+      return ;
+    }
+
+    ssize_t written = writev(stream->fd, iov_.data(), count);
+    if (-1 == written) {
+      if (EINTR == errno) {
+        continue;
+      }
+      if (EAGAIN != errno && EWOULDBLOCK != errno) {
+        ClosePeer(stream->peer, true);
+      }
+      // edge-triggered EPOLLOUT resumes the flush.
+      return ;
+    }
+
+    stream->queue.Consume(static_cast<size_t>(written));
+  }
+}
+
+void TcpTransport::FlushThrottled() {
+  for (auto& peer : peers_) {
+    for (auto& stream : peer.second->streams) {
+      if (stream->connected && stream->queue.Throttled()) {
+        Flush(stream.get());
+      }
+    }
+  }
+
+  std::vector<int> throttled;
+  for (const auto& snapshot : snapshots_) {
+    if (snapshot.second->throttled) {
+      throttled.push_back(snapshot.first);
+    }
+  }
+  for (int fd : throttled) {
+    HandleSnapshotEvents(fd, EPOLLOUT);
+  }
+}
+
+void TcpTransport::StartSnapshot(Peer* peer, uint64_t group_id,
+                                 std::unique_ptr<raftpb::Message> m) {
+  // the image goes as a file of its own, the rest has to fit a frame.
+  if (m->ByteSizeLong() - m->snapshot().data().size() > kMaxFrameSize) {
+    //Errorf, snapshot metadata is too large for a frame
+    handler_->ReportSnapshot(group_id, peer->id, true);
+    return ;
+  }
+
+  int file = open(m->snapshot().data().c_str(), O_RDONLY | O_CLOEXEC);
+  struct stat st;
+  if (-1 == file || 0 != fstat(file, &st)) {
+    //Errorf, cannot open snapshot image
+    if (-1 != file) {
+      close(file);
+    }
+    handler_->ReportSnapshot(group_id, peer->id, true);
+    return ;
+  }
+
+  int fd = ConnectTo(peer->host, peer->port);
+  if (-1 == fd) {
+    close(file);
+    handler_->ReportUnreachable(peer->id);
+    handler_->ReportSnapshot(group_id, peer->id, true);
+    return ;
+  }
+
+  std::unique_ptr<OutSnapshot> snapshot(new OutSnapshot);
+  snapshot->group_id  = group_id;
+  snapshot->to        = peer->id;
+  snapshot->fd        = fd;
+  snapshot->connected = false;
+  snapshot->throttled = false;
+  snapshot->sender.reset(new SnapshotSender(fd, file, st.st_size, group_id, *m,
+                                            peer->snapshot_bucket));
+  snapshots_[fd] = std::move(snapshot);
+
+  if (!loop_->Add(fd, EPOLLOUT | EPOLLRDHUP,
+                  [this, fd](uint32_t events) { HandleSnapshotEvents(fd, events); })) {
+    FinishSnapshot(fd, true);
+  }
+}
+
+void TcpTransport::HandleSnapshotEvents(int fd, uint32_t events) {
+  auto iter = snapshots_.find(fd);
+  if (snapshots_.end() == iter) {
+    return ;
+  }
+
+  OutSnapshot* snapshot = iter->second.get();
+  if (0 != (events & (EPOLLERR | EPOLLHUP | EPOLLRDHUP))) {
+    FinishSnapshot(fd, true);
+    return ;
+  }
+  if (!snapshot->connected) {
+    if (ConnectFailed(fd)) {
+      FinishSnapshot(fd, true);
+      return ;
+    }
+    snapshot->connected = true;
+  }
+
+  snapshot->throttled = false;
+  switch (snapshot->sender->Send(myutil::MonotonicMicros())) {
+    case SnapshotSender::Done:
+      FinishSnapshot(fd, false);
+      break;
+    case SnapshotSender::Throttled:
+      // resumed by FlushThrottled.
+      snapshot->throttled = true;
+      break;
+    case SnapshotSender::Again:
+      break;
+    default:
+      FinishSnapshot(fd, true);
+      break;
+  }
+}
+
+void TcpTransport::FinishSnapshot(int fd, bool failure) {
+  auto iter = snapshots_.find(fd);
+  uint64_t group_id = iter->second->group_id;
+  uint64_t to = iter->second->to;
+
+  loop_->Remove(fd);
+  // the image is handed to the kernel, close lets it drain to the peer.
+  close(fd);
+  snapshots_.erase(iter);
+
+  handler_->ReportSnapshot(group_id, to, failure);
+}
+
+void TcpTransport::ClosePeer(Peer* peer, bool unreachable) {
+  if (-1 == peer->streams[0]->fd) {
+    return ;
+  }
+
+  std::vector<uint64_t> snapshots;
+  for (auto& stream : peer->streams) {
+    if (-1 != stream->fd) {
+      loop_->Remove(stream->fd);
+      close(stream->fd);
+    }
+    stream->fd        = -1;
+    stream->connected = false;
+    stream->queue.Clear(&snapshots);
+  }
+  peer->retry_time = myutil::MonotonicMicros() + kReconnectInterval;
+
+  if (unreachable) {
+    handler_->ReportUnreachable(peer->id);
+  }
+  for (uint64_t group_id : snapshots) {
+    handler_->ReportSnapshot(group_id, peer->id, true);
+  }
+}
+
+void TcpTransport::ReportDropped(uint64_t group_id, const raftpb::Message& m) {
+  // the follower's progress waits in ProgressStateSnapshot until told.
+  if (raftpb::MsgSnap == m.type()) {
+    handler_->ReportSnapshot(group_id, m.to(), true);
+  }
+}
+
+void TcpTransport::UpdateReading() {
+  bool paused = pause_reading_.load();
+  if (paused == reading_paused_) {
+    return ;
+  }
+
+  // re-arming EPOLLIN reports whatever arrived while paused.
+  reading_paused_ = paused;
+  for (const auto& conn : conns_) {
+    if (!conn.second->snapshot) {
+      loop_->Modify(conn.first, paused ? EPOLLRDHUP : EPOLLIN | EPOLLRDHUP);
+    }
+  }
+}
+
+void TcpTransport::HandleAccept() {
+  while (true) {
+    int fd = accept4(listenfd_, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+    if (-1 == fd) {
+      if (EINTR == errno) {
+        continue;
+      }
+      return ;
+    }
+    SetNoDelay(fd);
+
+    uint32_t events = reading_paused_ ? EPOLLRDHUP : EPOLLIN | EPOLLRDHUP;
+    if (!loop_->Add(fd, events, [this, fd](uint32_t) { HandleConnEvents(fd); })) {
+      close(fd);
+      continue;
+    }
+    std::unique_ptr<Conn> conn(new Conn);
+    conn->fd = fd;
+    conn->probed = false;
+    conn->peer = 0;
+    conn->epoch = 0;
+    conn->features = 0;
+    conns_[fd] = std::move(conn);
+  }
+}
+
+void TcpTransport::HandleConnEvents(int fd) {
+  auto iter = conns_.find(fd);
+  if (conns_.end() == iter) {
+    return ;
+  }
+
+  Conn* conn = iter->second.get();
+  if (!conn->probed) {
+    char magic[kFrameHeaderSize];
+    ssize_t count = recv(fd, magic, sizeof(magic), MSG_PEEK);
+    if (count < static_cast<ssize_t>(sizeof(magic))) {
+      if (0 == count || (-1 == count && EAGAIN != errno && EWOULDBLOCK != errno && EINTR != errno)) {
+        CloseConn(fd);
+      }
+      // the rest of the 4 bytes is on its way and triggers another event.
+      return ;
+    }
+
+    conn->probed = true;
+    if (kSnapshotStreamMagic == myutil::DecodeFixed32(magic)) {
+      if (snapshot_dir_.empty()) {
+        //Warningf, snapshot streams are not enabled
+        CloseConn(fd);
+        return ;
+      }
+      conn->snapshot.reset(new SnapshotReceiver(fd, snapshot_dir_));
+    }
+  }
+  if (conn->snapshot) {
+    HandleSnapshotConn(conn);
+    return ;
+  }
+
+  FrameReader& reader = conn->reader;
+  FrameReader::Status status = reader.ReadFrom(fd);
+
+  // everything this wakeup read is handed over as one batch per group.
+  Batches batches;
+  FrameReader::Status next;
+  while (true) {
+    std::unique_ptr<raftpb::Message> m = NewMessage();
+    next = reader.Next(m.get());
+    if (FrameReader::Hello == next) {
+      HandleHello(conn);
+      pool_.push_back(std::move(m));
+      continue;
+    }
+    if (FrameReader::OK != next) {
+      pool_.push_back(std::move(m));
+      break;
+    }
+    if (0 != conn->peer && conn->epoch < reorders_[conn->peer].epoch) {
+      // a connection of an earlier incarnation that has not seen its reset.
+      pool_.push_back(std::move(m));
+      continue;
+    }
+    if (0 != reader.Seq() && 0 != conn->peer) {
+      Resequence(conn, std::move(m), &batches);
+    } else {
+      batches[reader.Group()].push_back(std::move(m));
+    }
+  }
+
+  for (auto& batch : batches) {
+    if (!batch.second.empty()) {
+      handler_->HandleMessages(batch.first, &batch.second);
+      Recycle(&batch.second);
+    }
+  }
+
+  if (FrameReader::ErrCorrupt == next || FrameReader::Again != status) {
+    CloseConn(fd);
+  }
+}
+
+void TcpTransport::HandleSnapshotConn(Conn* conn) {
+  SnapshotReceiver::Status status = conn->snapshot->Receive();
+  if (SnapshotReceiver::Again == status) {
+    return ;
+  }
+
+  if (SnapshotReceiver::Done == status) {
+    Messages msgs;
+    msgs.push_back(conn->snapshot->TakeMessage());
+    handler_->HandleMessages(conn->snapshot->Group(), &msgs);
+  } else {
+    //Warningf, dropping broken snapshot stream
+  }
+  CloseConn(conn->fd);
+}
+
+void TcpTransport::HandleHello(Conn* conn) {
+  const FrameReader& reader = conn->reader;
+  conn->peer     = reader.HelloId();
+  conn->epoch    = reader.HelloEpoch();
+  conn->features = reader.HelloFeatures();
+
+  // epochs only move forward. A hello of an older epoch is a connection of
+  // the previous set (or incarnation) still draining, it must not throw
+  // away what the current epoch has buffered, its frames are dropped.
+  PeerReorder& reorder = reorders_[conn->peer];
+  if (conn->epoch < reorder.epoch) {
+    //Warningf, dropping connection of an older epoch
+    return ;
+  }
+  if (conn->epoch > reorder.epoch) {
+    reorder.epoch = conn->epoch;
+    reorder.pending_bytes = 0;
+    for (auto& group : reorder.groups) {
+      for (auto& pending : group.second.pending) {
+        pool_.push_back(std::move(pending.second.m));
+      }
+    }
+    reorder.groups.clear();
+  }
+
+  UpdateFeatures(conn->peer);
+}
+
+void TcpTransport::Resequence(Conn* conn, std::unique_ptr<raftpb::Message> m, Batches* batches) {
+  uint64_t seq = conn->reader.Seq();
+  uint64_t group_id = conn->reader.Group();
+  PeerReorder& peer = reorders_[conn->peer];
+  ReorderBuffer& reorder = peer.groups[group_id];
+  if (conn->epoch != peer.epoch || seq < reorder.next_seq) {
+    // the tail of an older epoch.
+    pool_.push_back(std::move(m));
+    return ;
+  }
+
+  if (seq != reorder.next_seq) {
+    size_t size = conn->reader.FrameSize();
+    reorder.pending[seq] = ReorderBuffer::Pending{size, std::move(m)};
+    peer.pending_bytes += size;
+    if (peer.pending_bytes <= kMaxReorderBytes) {
+      return ;
+    }
+
+    // the gaps are not going to be filled, raft recovers from a lost MsgApp.
+    //Warningf, skipping missing MsgApp
+    for (auto& group : peer.groups) {
+      Messages& skipped = (*batches)[group.first];
+      for (auto& pending : group.second.pending) {
+        skipped.push_back(std::move(pending.second.m));
+        group.second.next_seq = pending.first + 1;
+      }
+      group.second.pending.clear();
+    }
+    peer.pending_bytes = 0;
+    return ;
+  }
+
+  Messages& msgs = (*batches)[group_id];
+  msgs.push_back(std::move(m));
+  reorder.next_seq++;
+  auto iter = reorder.pending.begin();
+  while (reorder.pending.end() != iter && reorder.next_seq == iter->first) {
+    msgs.push_back(std::move(iter->second.m));
+    peer.pending_bytes -= iter->second.size;
+    reorder.next_seq++;
+    iter = reorder.pending.erase(iter);
+  }
+}
+
+void TcpTransport::CloseConn(int fd) {
+  auto iter = conns_.find(fd);
+  uint64_t peer = conns_.end() != iter ? iter->second->peer : 0;
+
+  loop_->Remove(fd);
+  close(fd);
+  conns_.erase(fd);
+  if (0 != peer) {
+    UpdateFeatures(peer);
+  }
+}
+
+void TcpTransport::UpdateFeatures(uint64_t id) {
+  auto peer = peers_.find(id);
+  if (peers_.end() == peer) {
+    return ;
+  }
+  auto reorder = reorders_.find(id);
+  if (reorders_.end() == reorder) {
+    peer->second->compress = false;
+    return ;
+  }
+
+  // a restarted peer's old connections may linger, only its current epoch
+  // speaks for it.
+  bool compress = false;
+  for (auto& conn : conns_) {
+    if (id == conn.second->peer && reorder->second.epoch == conn.second->epoch &&
+        0 != (conn.second->features & kFeatureCompression)) {
+      compress = true;
+      break;
+    }
+  }
+  peer->second->compress = compression_ && compress;
+}
+
+std::unique_ptr<raftpb::Message> TcpTransport::NewMessage() {
+  if (pool_.empty()) {
+    return std::unique_ptr<raftpb::Message>(new raftpb::Message);
+  }
+
+  std::unique_ptr<raftpb::Message> m = std::move(pool_.back());
+  pool_.pop_back();
+  return m;
+}
+
+void TcpTransport::Recycle(Messages* msgs) {
+  for (auto& m : *msgs) {
+    if (m && pool_.size() < kMaxPooledMessages) {
+      pool_.push_back(std::move(m));
+    }
+  }
+  msgs->clear();
+}
+
+} // namespace myraft
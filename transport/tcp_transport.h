@@ -0,0 +1,268 @@
+#ifndef MYRAFT_TCP_TRANSPORT_H_
+#define MYRAFT_TCP_TRANSPORT_H_
+
+#include <stdint.h>
+#include <sys/uio.h>
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <raft/message_encoder.h>
+#include <raft/raftpb/raft.pb.h>
+
+#include "event_channel.h"
+#include "event_loop.h"
+#include "frame.h"
+#include "peer_queue.h"
+#include "snapshot_stream.h"
+#include "transport.h"
+
+namespace myraft {
+
+// TcpTransport sends length-prefixed frames (see frame.h) over one
+// persistent outbound connection per peer and receives on the connections
+// peers open to it. It runs on an EventLoop: Send hands messages over
+// through an EventChannel, and each wakeup encodes everything queued and
+// drains every peer with as few writev calls as the iovec limit allows.
+// Each peer's frames go through a PeerQueue, so control messages are never
+// stuck behind MsgApp or MsgSnap payloads and snapshots can be rate capped.
+//
+// Messages to a peer whose connection failed are dropped and reported
+// unreachable until kReconnectInterval has passed.
+//
+// Once EnableSnapshotStreams is called, the Snapshot.Data of an outgoing
+// MsgSnap is the path of a file holding the image. The file is streamed on
+// a connection of its own (see snapshot_stream.h) and the receiver gets the
+// MsgSnap with Data set to the path of its copy, which is in dir.
+//
+// Every connection starts with a hello frame naming the sender and what it
+// supports. After EnableCompression, MsgApp entries to a peer are deflated
+// once the peer's own hello says it has compression enabled too, which is
+// worth it on links where bandwidth rather than cpu is the bottleneck.
+//
+// With SetStreams(n), n connections are kept to every peer so replication
+// is not limited to one congestion window. MsgApp is striped across them
+// and numbered, the receiver puts them back in order before raft sees them
+// (up to kMaxReorderBytes held per peer), everything else travels on the
+// first connection. The connections to a peer are opened and closed
+// together, each set is an epoch of its own and numbering restarts with it.
+// Epochs only move forward, frames of an older one are dropped.
+//
+// Frames carry the id of their raft group, so every group talking to a peer
+// shares its connections and one wakeup's messages of all groups go out in
+// a single writev. On the way in, messages are split by group and each
+// group gets one HandleMessages call per wakeup. Sequencing is per group,
+// a gap in one group holds back no other.
+class TcpTransport : public Transport {
+ public:
+  static const int      kMaxIovecs         = 256;
+  static const size_t   kMaxPendingBytes   = 256 << 20;
+  // microseconds between connection attempts to a failed peer.
+  static const uint64_t kReconnectInterval = 100000;
+  static const size_t   kMaxPooledMessages = 1024;
+  // frames committed ahead of a new heartbeat, see PeerQueue.
+  static const size_t   kMaxWireBytes      = 256 << 10;
+  // microseconds between retries of snapshot frames held back by the cap.
+  static const uint64_t kThrottleInterval  = 10000;
+  // bytes of out of order MsgApp held per peer before giving up on the gaps.
+  // A receiver drains one socket at a time, so this has to cover what the
+  // socket buffers of all streams hold.
+  static const size_t   kMaxReorderBytes   = 64 << 20;
+
+ public:
+  // snapshot_rate caps MsgSnap bytes per second to each peer, 0 is unlimited.
+  TcpTransport(uint64_t id, myutil::EventLoop* loop, Handler* handler,
+               uint64_t snapshot_rate = 0);
+  // must run on the loop thread, or once the loop stopped.
+  virtual ~TcpTransport();
+
+  // the calls below must run on the loop thread, or before it runs.
+  bool Start();
+  // ipv4 dotted address, port 0 picks a free port, see Port.
+  bool Listen(const std::string& host, uint16_t port);
+  uint16_t Port() const { return port_; }
+  void AddPeer(uint64_t id, const std::string& host, uint16_t port);
+  void RemovePeer(uint64_t id);
+  // dir receives the images of incoming snapshots.
+  void EnableSnapshotStreams(const std::string& dir) { snapshot_dir_ = dir; }
+  void EnableCompression() { compression_ = true; }
+  // connections per peer, for peers added afterwards. 1 by default.
+  void SetStreams(size_t n) { streams_ = n > 0 ? n : 1; }
+
+  // thread-safe, after Start. Stops and restarts reading messages, e.g. from
+  // the watermarks of a bounded inbox the Handler feeds (see MultiRaft).
+  // Snapshot streams already under way go on, their images go to files.
+  void PauseReading();
+  void ResumeReading();
+
+  using Transport::Send;
+  virtual void Send(uint64_t group_id, std::unique_ptr<raftpb::Message> m) override;
+  virtual void Send(uint64_t group_id, Messages* msgs) override;
+
+ private:
+  struct Peer;
+
+  // one connection to a peer.
+  struct Stream {
+    Stream(Peer* peer, size_t index, std::shared_ptr<myutil::TokenBucket> snapshot_bucket)
+        : peer(peer), index(index), fd(-1), connected(false),
+          queue(std::move(snapshot_bucket), kMaxWireBytes), dirty(false) {}
+
+    Peer*     peer;
+    size_t    index;
+    int       fd;
+    bool      connected;
+    PeerQueue queue;
+    bool      dirty;
+  }; // struct Stream
+
+  struct Peer {
+    Peer(uint64_t id, const std::string& host, uint16_t port, uint64_t snapshot_rate,
+         size_t streams)
+        : id(id), host(host), port(port),
+          // a tenth of a second worth of burst.
+          snapshot_bucket(new myutil::TokenBucket(snapshot_rate, snapshot_rate / 10)),
+          epoch(0), next_stream(0), retry_time(0), compress(false) {
+      for (size_t i = 0; i < streams; i++) {
+        this->streams.emplace_back(new Stream(this, i, snapshot_bucket));
+      }
+    }
+
+    uint64_t    id;
+    std::string host;
+    uint16_t    port;
+    // MsgSnap bytes of all streams and snapshot streams to the peer, a
+    // snapshot stream may outlive the peer.
+    std::shared_ptr<myutil::TokenBucket> snapshot_bucket;
+
+    // streams[0] carries everything but striped MsgApp.
+    std::vector<std::unique_ptr<Stream>> streams;
+    uint64_t    epoch;
+    // by group, of the current epoch.
+    std::map<uint64_t, uint64_t> next_seqs;
+    size_t      next_stream;
+    uint64_t    retry_time;
+    // an inbound connection of the peer's current epoch advertised
+    // compression, see UpdateFeatures.
+    bool        compress;
+  }; // struct Peer
+
+  struct Conn {
+    int         fd;
+    // the first 4 bytes were looked at, see kSnapshotStreamMagic.
+    bool        probed;
+    FrameReader reader;
+    std::unique_ptr<SnapshotReceiver> snapshot;
+    // from the hello, 0 until it arrives.
+    uint64_t    peer;
+    uint64_t    epoch;
+    uint32_t    features;
+  }; // struct Conn
+
+  // sequenced MsgApp of one group.
+  struct ReorderBuffer {
+    struct Pending {
+      // on the wire.
+      size_t size;
+      std::unique_ptr<raftpb::Message> m;
+    }; // struct Pending
+
+    ReorderBuffer() : next_seq(1) {}
+
+    uint64_t next_seq;
+    std::map<uint64_t, Pending> pending;
+  }; // struct ReorderBuffer
+
+  // the reorder buffers of the current epoch of one peer.
+  struct PeerReorder {
+    uint64_t epoch;
+    size_t   pending_bytes;
+    std::map<uint64_t, ReorderBuffer> groups;
+  }; // struct PeerReorder
+
+  // a message waiting in the outbox, owned.
+  struct Outgoing {
+    uint64_t         group_id;
+    raftpb::Message* m;
+  }; // struct Outgoing
+
+  // one wakeup's messages by group.
+  using Batches = std::map<uint64_t, Messages>;
+
+  struct OutSnapshot {
+    uint64_t group_id;
+    uint64_t to;
+    int      fd;
+    bool     connected;
+    bool     throttled;
+    std::unique_ptr<SnapshotSender> sender;
+  }; // struct OutSnapshot
+
+  void HandleOutbox();
+  void Enqueue(uint64_t group_id, std::unique_ptr<raftpb::Message> m);
+  bool Connect(Peer* peer);
+  bool ConnectStream(Peer* peer, Stream* stream);
+  void HandleStreamEvents(uint64_t id, size_t index, uint32_t events);
+  void Flush(Stream* stream);
+  // reports the loss of any MsgSnap left in the queues.
+  void ClosePeer(Peer* peer, bool unreachable);
+  // a MsgSnap dropped before it is queued is reported as failed.
+  void ReportDropped(uint64_t group_id, const raftpb::Message& m);
+  void FlushThrottled();
+
+  void StartSnapshot(Peer* peer, uint64_t group_id, std::unique_ptr<raftpb::Message> m);
+  void HandleSnapshotEvents(int fd, uint32_t events);
+  void FinishSnapshot(int fd, bool failure);
+
+  // brings the connections in line with pause_reading_.
+  void UpdateReading();
+  void HandleAccept();
+  void HandleConnEvents(int fd);
+  void HandleSnapshotConn(Conn* conn);
+  void HandleHello(Conn* conn);
+  void Resequence(Conn* conn, std::unique_ptr<raftpb::Message> m, Batches* batches);
+  void CloseConn(int fd);
+  // what a peer supports is what its open connections of the current epoch
+  // advertised, rechecked whenever one of them comes or goes.
+  void UpdateFeatures(uint64_t id);
+
+  std::unique_ptr<raftpb::Message> NewMessage();
+  void Recycle(Messages* msgs);
+
+ private:
+  const uint64_t id_;
+  myutil::EventLoop* loop_;
+  Handler* handler_;
+  const uint64_t snapshot_rate_;
+  int throttle_timer_;
+
+  // owned pointers, a SpinQueue cannot hold unique_ptr. A nullptr only
+  // wakes the loop up.
+  std::unique_ptr<myutil::EventChannel<Outgoing>> outbox_;
+  // as asked for, and as applied to the connections on the loop thread.
+  std::atomic<bool> pause_reading_;
+  bool              reading_paused_;
+
+  int      listenfd_;
+  uint16_t port_;
+  std::map<uint64_t, std::unique_ptr<Peer>> peers_;
+  std::map<int, std::unique_ptr<Conn>>      conns_;
+
+  bool        compression_;
+  size_t      streams_;
+  std::map<uint64_t, PeerReorder> reorders_;
+  std::string snapshot_dir_;
+  std::map<int, std::unique_ptr<OutSnapshot>> snapshots_;
+
+  MessageEncoder           encoder_;
+  Messages                 pool_;
+  std::vector<Stream*>     dirty_;
+  std::vector<struct iovec> iov_;
+}; // class TcpTransport
+
+} // namespace myraft
+
+#endif // MYRAFT_TCP_TRANSPORT_H_
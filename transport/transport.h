@@ -0,0 +1,59 @@
+#ifndef MYRAFT_TRANSPORT_H_
+#define MYRAFT_TRANSPORT_H_
+
+#include <stdint.h>
+
+#include <memory>
+#include <vector>
+
+#include <raft/raftpb/raft.pb.h>
+
+namespace myraft {
+
+// Transport moves raft messages between nodes. Delivery is best effort:
+// messages may be dropped, raft retries on its own.
+//
+// Every message belongs to a raft group, all groups between two nodes share
+// the same connections. Group 0 is for a node running a single raft.
+class Transport {
+ public:
+  using Messages = std::vector<std::unique_ptr<raftpb::Message>>;
+
+  class Handler {
+   public:
+    Handler()          = default;
+    virtual ~Handler() = default;
+
+    // messages of group_id received from the network, in arrival order per
+    // connection. A wakeup's messages come in one call per group. The
+    // transport recycles every message still left in msgs on return, move
+    // out the ones to keep.
+    virtual void HandleMessages(uint64_t group_id, Messages* msgs) = 0;
+    // a message to id could not be delivered, see RawNode::ReportUnreachable.
+    virtual void ReportUnreachable(uint64_t id) = 0;
+    // the outcome of a streamed MsgSnap of group_id to id, see
+    // RawNode::ReportSnapshot.
+    virtual void ReportSnapshot(uint64_t group_id, uint64_t id, bool failure) = 0;
+  }; // class Handler
+
+ public:
+  Transport()          = default;
+  virtual ~Transport() = default;
+
+  Transport(const Transport&)            = delete;
+  Transport& operator=(const Transport&) = delete;
+  Transport(Transport&&)                 = delete;
+  Transport& operator=(Transport&&)      = delete;
+
+  // thread-safe, routes by m->to().
+  virtual void Send(uint64_t group_id, std::unique_ptr<raftpb::Message> m) = 0;
+  // thread-safe, msgs is left empty.
+  virtual void Send(uint64_t group_id, Messages* msgs) = 0;
+
+  void Send(std::unique_ptr<raftpb::Message> m) { Send(0, std::move(m)); }
+  void Send(Messages* msgs) { Send(0, msgs); }
+}; // class Transport
+
+} // namespace myraft
+
+#endif // MYRAFT_TRANSPORT_H_
@@ -0,0 +1,52 @@
+#ifndef MYUTIL_CODING_H_
+#define MYUTIL_CODING_H_
+
+#include <stdint.h>
+#include <string.h>
+
+#include <string>
+
+namespace myutil {
+
+// fixed-width little-endian integers.
+
+inline void EncodeFixed32(char* buf, uint32_t value) {
+  buf[0] = static_cast<char>(value & 0xff);
+  buf[1] = static_cast<char>((value >> 8) & 0xff);
+  buf[2] = static_cast<char>((value >> 16) & 0xff);
+  buf[3] = static_cast<char>((value >> 24) & 0xff);
+}
+
+inline void EncodeFixed64(char* buf, uint64_t value) {
+  EncodeFixed32(buf, static_cast<uint32_t>(value));
+  EncodeFixed32(buf + 4, static_cast<uint32_t>(value >> 32));
+}
+
+inline uint32_t DecodeFixed32(const char* ptr) {
+  const unsigned char* p = reinterpret_cast<const unsigned char*>(ptr);
+  return static_cast<uint32_t>(p[0]) |
+         (static_cast<uint32_t>(p[1]) << 8) |
+         (static_cast<uint32_t>(p[2]) << 16) |
+         (static_cast<uint32_t>(p[3]) << 24);
+}
+
+inline uint64_t DecodeFixed64(const char* ptr) {
+  return static_cast<uint64_t>(DecodeFixed32(ptr)) |
+         (static_cast<uint64_t>(DecodeFixed32(ptr + 4)) << 32);
+}
+
+inline void PutFixed32(std::string* dst, uint32_t value) {
+  char buf[sizeof(value)];
+  EncodeFixed32(buf, value);
+  dst->append(buf, sizeof(buf));
+}
+
+inline void PutFixed64(std::string* dst, uint64_t value) {
+  char buf[sizeof(value)];
+  EncodeFixed64(buf, value);
+  dst->append(buf, sizeof(buf));
+}
+
+} // namespace myutil
+
+#endif // MYUTIL_CODING_H_
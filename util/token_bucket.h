@@ -0,0 +1,64 @@
+#ifndef MYUTIL_TOKEN_BUCKET_H_
+#define MYUTIL_TOKEN_BUCKET_H_
+
+#include <stdint.h>
+
+namespace myutil {
+
+// TokenBucket caps a rate in units (bytes) per second. Tokens may go
+// negative: a take larger than what is saved up still goes through and is
+// paid off before the next one, so the average rate holds for any size.
+class TokenBucket {
+ public:
+  // a rate of 0 is unlimited. burst caps the tokens saved up while idle.
+  TokenBucket(uint64_t rate, uint64_t burst)
+      : rate_(rate),
+        burst_(static_cast<int64_t>(burst)),
+        tokens_(static_cast<int64_t>(burst)),
+        refill_time_(0),
+        remainder_(0) {}
+  ~TokenBucket() = default;
+
+  TokenBucket(const TokenBucket&)            = default;
+  TokenBucket& operator=(const TokenBucket&) = default;
+  TokenBucket(TokenBucket&&)                 = default;
+  TokenBucket& operator=(TokenBucket&&)      = default;
+
+  // now is in microseconds.
+  void Refill(uint64_t now) {
+    if (0 == rate_ || now <= refill_time_) {
+      return ;
+    }
+    if (0 != refill_time_) {
+      // the fraction of a token is kept, or refills more often than once a
+      // token would never add up to one at a low rate.
+      remainder_ += (now - refill_time_) * rate_;
+      tokens_    += static_cast<int64_t>(remainder_ / 1000000);
+      remainder_ %= 1000000;
+    }
+    if (tokens_ >= burst_) {
+      tokens_    = burst_;
+      remainder_ = 0;
+    }
+    refill_time_ = now;
+  }
+
+  bool Ready() const { return 0 == rate_ || tokens_ > 0; }
+  void Take(uint64_t count) {
+    if (0 != rate_) {
+      tokens_ -= static_cast<int64_t>(count);
+    }
+  }
+
+ private:
+  uint64_t rate_;
+  int64_t  burst_;
+  int64_t  tokens_;
+  uint64_t refill_time_;
+  // token microseconds short of a whole token.
+  uint64_t remainder_;
+}; // class TokenBucket
+
+} // namespace myutil
+
+#endif // MYUTIL_TOKEN_BUCKET_H_
@@ -1,12 +1,21 @@
 #ifndef MYUTIL_UTIL_H_
 #define MYUTIL_UTIL_H_
 
+#include <stdint.h>
+
 #include <string>
 
 namespace myutil {
 
 extern std::string String(bool value);
 
+// microseconds from CLOCK_MONOTONIC, unaffected by wall clock adjustments.
+extern uint64_t MonotonicMicros();
+
+// microseconds since the epoch from CLOCK_REALTIME, keeps counting across
+// reboots but may step back.
+extern uint64_t WallMicros();
+
 } // namespace myutil
 
 #endif // MYUTIL_UTIL_H_